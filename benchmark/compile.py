@@ -0,0 +1,194 @@
+# Copyright Nezametdinov E. Ildus 2022.
+# Distributed under the Boost Software License, Version 1.0.
+# (See accompanying file LICENSE_1_0.txt or copy at
+# https://www.boost.org/LICENSE_1_0.txt)
+#
+# Measures compile time of synthetic translation units which use the library.
+#
+import argparse
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+# Parse command line arguments.
+parser = argparse.ArgumentParser()
+parser.add_argument(\
+    "--compilers",\
+    help = "compilers to benchmark (default: g++ and clang++, if found)",\
+    nargs = '+',\
+    default = [c for c in ["g++", "clang++"] if shutil.which(c)])
+parser.add_argument(\
+    "--limits",\
+    help = "limits with which headers are generated",\
+    nargs = '+',\
+    type = int,\
+    default = [127, 256, 512])
+parser.add_argument(\
+    "--structs",\
+    help = "number of structs in each translation unit",\
+    type = int,\
+    default = 1000)
+parser.add_argument(\
+    "--members",\
+    help = "maximum number of data members in each struct",\
+    type = int,\
+    default = 40)
+parser.add_argument(\
+    "--output",\
+    help = "name of the file to which results are written in JSON format")
+
+args = parser.parse_args()
+
+# Directory which contains the repository.
+root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+# Member types of the generated structs.
+scalar_types = ["int", "double", "char", "float", "long", "short", "unsigned"]
+
+# Generates a struct with the given index, and returns its source code.
+def generate_struct(shape, index):
+    n = 1 + (index * 7) % args.members
+    types = [scalar_types[(index + i) % len(scalar_types)] for i in range(n)]
+
+    if shape == "nested":
+        # Every third member is an aggregate.
+        types = [(f"struct {{ {t} a; char b; }}" if i % 3 == 0 else t)\
+                 for i, t in enumerate(types)]
+    elif shape == "arrays":
+        # Every fourth member is an array.
+        types = [(t, f"[{1 + i % 8}]") if i % 4 == 0 else (t, "")\
+                 for i, t in enumerate(types)]
+        return f"struct s{index} {{ " +\
+            " ".join([f"{t} m{i}{a};" for i, (t, a) in enumerate(types)]) +\
+            " };"
+
+    return f"struct s{index} {{ " +\
+        " ".join([f"{t} m{i};" for i, t in enumerate(types)]) + " };"
+
+# Generates a translation unit, and returns its source code.
+def generate_translation_unit(header, shape, mode):
+    lines = [f'#include "{header}"', "#include <tuple>", ""]
+
+    for i in range(args.structs):
+        lines.append(generate_struct(shape, i))
+
+        if mode == "count":
+            lines.append(f"constexpr auto c{i} ="\
+                         f" mirror::data_member_count<s{i}>;")
+        else:
+            lines.append(f"auto f{i}(s{i}& x) {{"\
+                         f" return std::get<0>(mirror::reflect(x)); }}")
+
+    return "\n".join(lines) + "\n"
+
+# Summarizes the given -ftime-trace file produced by clang.
+def summarize_time_trace(file_name):
+    with open(file_name, 'r') as file:
+        events = json.load(file)["traceEvents"]
+
+    patterns = {\
+        "data_member_count": re.compile("count_data_members|data_member_count"),
+        "reflect": re.compile("mirror::reflect|reflector<")}
+
+    summary = {}
+    for key, pattern in patterns.items():
+        # Only count outermost events, since nested instantiations are already
+        # included in the duration of the event which caused them.
+        total, end = 0, -1
+        matching = [e for e in events if e.get("ph") == "X" and\
+                    pattern.search(e.get("args", {}).get("detail", ""))]
+
+        for e in sorted(matching, key = lambda e: e["ts"]):
+            if e["ts"] >= end:
+                total += e["dur"]
+                end = e["ts"] + e["dur"]
+
+        summary[key] = total / 1e6
+
+    return summary
+
+# Summarizes the given -ftime-report output produced by GCC.
+def summarize_time_report(output):
+    summary = {}
+    for line in output.splitlines():
+        match = re.match(\
+            r"^ (phase parsing|phase lang\. deferred|template instantiation"\
+            r"|constraint satisfaction)\s*:" + r"\s*([\d.]+) \(\s*\d+%\)" * 3,\
+            line)
+
+        if match:
+            summary[match.group(1)] = float(match.group(4))
+
+    return summary
+
+# Compiles the given file, and returns the results of the measurement.
+def compile(compiler, file_name, directory):
+    clang = "clang" in os.path.basename(compiler)
+    command = [compiler, "-std=c++20", "-c", file_name, "-o",\
+               os.path.join(directory, "tu.o")]
+    command += ["-ftime-trace"] if clang else ["-ftime-report"]
+
+    start = time.perf_counter()
+    process = subprocess.Popen(\
+        command, stdout = subprocess.DEVNULL, stderr = subprocess.PIPE,\
+        text = True)
+    stderr = process.stderr.read()
+    _, status, usage = os.wait4(process.pid, 0)
+    wall_time = time.perf_counter() - start
+    process.returncode = os.waitstatus_to_exitcode(status)
+
+    if process.returncode != 0:
+        sys.exit(f"Error: {compiler} failed to compile {file_name}:\n{stderr}")
+
+    # Peak resident set size is reported in kilobytes on Linux.
+    result = {"wall_time": wall_time, "peak_rss_mb": usage.ru_maxrss / 1024}
+
+    if clang:
+        result["time_trace"] =\
+            summarize_time_trace(os.path.join(directory, "tu.json"))
+    else:
+        result["time_report"] = summarize_time_report(stderr)
+
+    return result
+
+# Run the benchmarks.
+results = []
+with tempfile.TemporaryDirectory() as directory:
+    for limit in args.limits:
+        # Generate the header with the given limit.
+        header = os.path.join(directory, f"mirror_{limit}", "mirror.hh")
+        os.makedirs(os.path.dirname(header))
+        subprocess.run(\
+            [sys.executable, os.path.join(root, "meta.py"),\
+             os.path.join(root, "meta"), os.path.dirname(header), str(limit)],\
+            check = True)
+
+        # Array members are counted once each, so types with such members are
+        # both counted and reflected.
+        for shape, mode in [("flat", "count"), ("flat", "reflect"),\
+                            ("nested", "count"), ("nested", "reflect"),\
+                            ("arrays", "count"), ("arrays", "reflect")]:
+            file_name = os.path.join(directory, "tu.cc")
+            with open(file_name, 'w') as file:
+                file.write(generate_translation_unit(header, shape, mode))
+
+            for compiler in args.compilers:
+                result = {"compiler": compiler, "limit": limit,\
+                          "shape": shape, "mode": mode}
+                result.update(compile(compiler, file_name, directory))
+                results.append(result)
+
+                print(f"{compiler:>10} limit {limit:>4} {shape:>7} {mode:>8}:"\
+                      f" {result['wall_time']:8.2f} s"\
+                      f" {result['peak_rss_mb']:8.0f} MB",\
+                      json.dumps(result.get("time_trace",\
+                                            result.get("time_report"))))
+
+if args.output:
+    with open(args.output, 'w') as file:
+        json.dump(results, file, indent = 4)
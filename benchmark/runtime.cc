@@ -0,0 +1,831 @@
+// Copyright Nezametdinov E. Ildus 2022.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+//
+// Measures run time of operations which use the library on a fixed corpus of
+// struct shapes, and of the equivalent hand-written code. For each shape,
+// operation and implementation prints a line with the number of nanoseconds
+// per operation, the number of processed bytes per second, and the number of
+// executed instructions per operation (if hardware counters are available).
+// Results of both implementations are checked for equality before measuring.
+//
+// Operations which are not supported on a shape are not measured, and lines
+// which start with # and show the reason are printed instead.
+//
+// Usage: runtime [minimum number of milliseconds per measurement]
+//
+#include "mirror.hh"
+#include "mirror_compare.hh"
+#include "mirror_hash.hh"
+#include "mirror_serialization.hh"
+#include "mirror_soa.hh"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <functional>
+#include <span>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+////////////////////////////////////////////////////////////////////////////////
+// Measurement.
+////////////////////////////////////////////////////////////////////////////////
+
+// Number of records which each measured call processes.
+constexpr auto record_count = std::size_t{1024};
+
+// Prevents the compiler from optimizing away the computation of the given
+// value.
+template <typename T>
+void
+keep(const T& x) noexcept {
+    asm volatile("" : : "g"(&x) : "memory");
+}
+
+// A counter of instructions which are executed by the calling thread in user
+// space. It is not available if the kernel does not allow access to hardware
+// counters.
+class instruction_counter {
+public:
+    instruction_counter() noexcept {
+#if defined(__linux__)
+        auto attributes = perf_event_attr{};
+        attributes.type = PERF_TYPE_HARDWARE;
+        attributes.size = sizeof(attributes);
+        attributes.config = PERF_COUNT_HW_INSTRUCTIONS;
+        attributes.disabled = 1;
+        attributes.exclude_kernel = 1;
+        attributes.exclude_hv = 1;
+
+        fd_ = static_cast<int>(
+            ::syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+#endif
+    }
+
+    instruction_counter(const instruction_counter&) = delete;
+
+    ~instruction_counter() {
+#if defined(__linux__)
+        if(fd_ != -1) {
+            ::close(fd_);
+        }
+#endif
+    }
+
+    auto
+    operator=(const instruction_counter&) -> instruction_counter& = delete;
+
+    auto
+    is_available() const noexcept -> bool {
+        return fd_ != -1;
+    }
+
+    void
+    start() noexcept {
+#if defined(__linux__)
+        if(fd_ != -1) {
+            ::ioctl(fd_, PERF_EVENT_IOC_RESET, 0);
+            ::ioctl(fd_, PERF_EVENT_IOC_ENABLE, 0);
+        }
+#endif
+    }
+
+    // Stops the counter, and returns the number of instructions which were
+    // executed since it was started.
+    auto
+    stop() noexcept -> std::uint64_t {
+        auto count = std::uint64_t{};
+#if defined(__linux__)
+        if(fd_ != -1) {
+            ::ioctl(fd_, PERF_EVENT_IOC_DISABLE, 0);
+            if(::read(fd_, &count, sizeof(count)) != sizeof(count)) {
+                count = 0;
+            }
+        }
+#endif
+        return count;
+    }
+
+private:
+    int fd_{-1};
+};
+
+// Minimum duration of each measurement.
+auto min_duration = std::chrono::nanoseconds{std::chrono::milliseconds{100}};
+
+// Measures the given function, which performs the given number of operations
+// on each call, each operation processing the given number of bytes, and
+// prints the results.
+template <typename F>
+void
+measure(const char* shape, const char* operation, const char* implementation,
+        std::size_t operation_count, std::size_t byte_count, F f) {
+    using clock = std::chrono::steady_clock;
+
+    // Warm up caches, and find the number of calls which takes at least the
+    // minimum duration.
+    keep(f());
+
+    auto call_count = std::size_t{1};
+    for(;;) {
+        auto start = clock::now();
+        for(auto i = std::size_t{0}; i != call_count; ++i) {
+            keep(f());
+        }
+
+        if(clock::now() - start >= min_duration / 4) {
+            call_count *= 4;
+            break;
+        }
+
+        call_count *= 2;
+    }
+
+    static auto counter = instruction_counter{};
+
+    counter.start();
+    auto start = clock::now();
+    for(auto i = std::size_t{0}; i != call_count; ++i) {
+        keep(f());
+    }
+
+    auto duration = std::chrono::duration<double, std::nano>{
+        clock::now() - start};
+    auto instructions = counter.stop();
+
+    auto n = static_cast<double>(call_count * operation_count);
+    auto ns = duration.count() / n;
+
+    std::printf("%s\t%s\t%s\t%.3f\t%.0f", shape, operation, implementation, ns,
+                static_cast<double>(byte_count) * 1e9 / ns);
+
+    if(counter.is_available()) {
+        std::printf("\t%.1f\n", static_cast<double>(instructions) / n);
+    } else {
+        std::printf("\t-\n");
+    }
+}
+
+// Prints the line which shows that the given operation is not measured on the
+// given shape, and why.
+void
+omit(const char* shape, const char* operation, const char* reason) {
+    std::printf("# %s\t%s\tomitted: %s\n", shape, operation, reason);
+}
+
+// Terminates the program if the results of the two implementations of the
+// given operation differ.
+void
+check(bool is_equal, const char* shape, const char* operation) {
+    if(!is_equal) {
+        std::fprintf(stderr, "Error: results of %s on %s records differ\n",
+                     operation, shape);
+        std::exit(EXIT_FAILURE);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Corpus.
+////////////////////////////////////////////////////////////////////////////////
+
+// Computes a digest of the given value, which is used to check visitation.
+template <typename T>
+auto
+digest(const T& x) noexcept -> std::uint64_t {
+    if constexpr(std::is_arithmetic_v<T>) {
+        return static_cast<std::uint64_t>(x);
+    } else {
+        return x.size();
+    }
+}
+
+// Mixes the given value into the given state of the hash function of the
+// library, as the hash function does with members of types which do not have
+// unique object representations.
+template <typename T>
+auto
+mix(std::uint64_t h, const T& x) noexcept -> std::uint64_t {
+    return mirror::detail::hash_round(h, std::hash<T>{}(x));
+}
+
+// Mixes the object representation of the given value (of at most 8 bytes) into
+// the given state of the hash function, as the hash function does with members
+// which have unique object representations.
+template <typename T>
+auto
+mix_bytes(std::uint64_t h, const T& x) noexcept -> std::uint64_t {
+    auto word = std::uint64_t{};
+    std::memcpy(&word, &x, sizeof(x));
+
+    return mirror::detail::hash_round(h, word);
+}
+
+// Appends the object representation of the given value to the given buffer.
+template <typename T>
+void
+put(std::byte*& out, const T& x) noexcept {
+    std::memcpy(out, &x, sizeof(x));
+    out += sizeof(x);
+}
+
+// Small records with padding.
+struct small_record {
+    std::uint32_t id;
+    std::uint16_t kind;
+    std::uint8_t flags;
+    double value;
+};
+
+// Columns of small records, and hand-written operations on them.
+struct small_shape {
+    using record = small_record;
+
+    struct columns {
+        std::vector<std::uint32_t> id;
+        std::vector<std::uint16_t> kind;
+        std::vector<std::uint8_t> flags;
+        std::vector<double> value;
+    };
+
+    static constexpr auto name = "small";
+
+    static auto
+    make(std::size_t i) -> record {
+        return {static_cast<std::uint32_t>(i),
+                static_cast<std::uint16_t>(i % 7),
+                static_cast<std::uint8_t>(i % 3), static_cast<double>(i) / 2};
+    }
+
+    static auto
+    make_columns() -> columns {
+        return {std::vector<std::uint32_t>(record_count),
+                std::vector<std::uint16_t>(record_count),
+                std::vector<std::uint8_t>(record_count),
+                std::vector<double>(record_count)};
+    }
+
+    static auto
+    spans(columns& c) -> mirror::column_spans<record> {
+        return {c.id, c.kind, c.flags, c.value};
+    }
+
+    static auto
+    visit(const record& x) noexcept -> std::uint64_t {
+        return digest(x.id) + digest(x.kind) + digest(x.flags) +
+               digest(x.value);
+    }
+
+    static auto
+    hash(const record& x) noexcept -> std::size_t {
+        auto h = mirror::detail::hash_seed;
+        h = mix_bytes(h, x.id);
+        h = mix_bytes(h, x.kind);
+        h = mix_bytes(h, x.flags);
+        h = mix(h, x.value);
+
+        return mirror::detail::hash_finalize(h);
+    }
+
+    static auto
+    equal(const record& x, const record& y) noexcept -> bool {
+        return (x.id == y.id) && (x.kind == y.kind) && (x.flags == y.flags) &&
+               (x.value == y.value);
+    }
+
+    static void
+    serialize(std::byte* out, const record& x) noexcept {
+        put(out, x.id);
+        put(out, x.kind);
+        put(out, x.flags);
+        put(out, x.value);
+    }
+
+    static void
+    transpose(std::span<const record> rows, columns& c) noexcept {
+        for(auto i = std::size_t{0}; i != rows.size(); ++i) {
+            c.id[i] = rows[i].id;
+            c.kind[i] = rows[i].kind;
+            c.flags[i] = rows[i].flags;
+            c.value[i] = rows[i].value;
+        }
+    }
+};
+
+// Members of wide rows: 64 alternating integers and floating-point numbers.
+#define WIDE_MEMBERS(X) \
+    X(m00, std::int32_t) X(m01, float) X(m02, std::int32_t) X(m03, float) \
+    X(m04, std::int32_t) X(m05, float) X(m06, std::int32_t) X(m07, float) \
+    X(m08, std::int32_t) X(m09, float) X(m10, std::int32_t) X(m11, float) \
+    X(m12, std::int32_t) X(m13, float) X(m14, std::int32_t) X(m15, float) \
+    X(m16, std::int32_t) X(m17, float) X(m18, std::int32_t) X(m19, float) \
+    X(m20, std::int32_t) X(m21, float) X(m22, std::int32_t) X(m23, float) \
+    X(m24, std::int32_t) X(m25, float) X(m26, std::int32_t) X(m27, float) \
+    X(m28, std::int32_t) X(m29, float) X(m30, std::int32_t) X(m31, float) \
+    X(m32, std::int32_t) X(m33, float) X(m34, std::int32_t) X(m35, float) \
+    X(m36, std::int32_t) X(m37, float) X(m38, std::int32_t) X(m39, float) \
+    X(m40, std::int32_t) X(m41, float) X(m42, std::int32_t) X(m43, float) \
+    X(m44, std::int32_t) X(m45, float) X(m46, std::int32_t) X(m47, float) \
+    X(m48, std::int32_t) X(m49, float) X(m50, std::int32_t) X(m51, float) \
+    X(m52, std::int32_t) X(m53, float) X(m54, std::int32_t) X(m55, float) \
+    X(m56, std::int32_t) X(m57, float) X(m58, std::int32_t) X(m59, float) \
+    X(m60, std::int32_t) X(m61, float) X(m62, std::int32_t) X(m63, float)
+
+// Wide rows without padding.
+struct wide_record {
+#define DECLARE(name, type) type name;
+    WIDE_MEMBERS(DECLARE)
+#undef DECLARE
+};
+
+// Columns of wide rows, and hand-written operations on them.
+struct wide_shape {
+    using record = wide_record;
+
+    struct columns {
+#define DECLARE(name, type) std::vector<type> name;
+        WIDE_MEMBERS(DECLARE)
+#undef DECLARE
+    };
+
+    static constexpr auto name = "wide";
+
+    static auto
+    make(std::size_t i) -> record {
+        auto x = record{};
+        auto k = std::size_t{0};
+#define ASSIGN(name, type) x.name = static_cast<type>(i + k++);
+        WIDE_MEMBERS(ASSIGN)
+#undef ASSIGN
+        return x;
+    }
+
+    static auto
+    make_columns() -> columns {
+        auto c = columns{};
+#define RESIZE(name, type) c.name.resize(record_count);
+        WIDE_MEMBERS(RESIZE)
+#undef RESIZE
+        return c;
+    }
+
+    static auto
+    spans(columns& c) -> mirror::column_spans<record> {
+#define SPAN(name, type) c.name,
+        return {WIDE_MEMBERS(SPAN)};
+#undef SPAN
+    }
+
+    static auto
+    visit(const record& x) noexcept -> std::uint64_t {
+        auto r = std::uint64_t{};
+#define VISIT(name, type) r += digest(x.name);
+        WIDE_MEMBERS(VISIT)
+#undef VISIT
+        return r;
+    }
+
+    static auto
+    hash(const record& x) noexcept -> std::size_t {
+        auto h = mirror::detail::hash_seed;
+#define MIX(name, type)                                         \
+    h = std::is_floating_point_v<type> ? mix(h, x.name) : mix_bytes(h, x.name);
+        WIDE_MEMBERS(MIX)
+#undef MIX
+        return mirror::detail::hash_finalize(h);
+    }
+
+    static auto
+    equal(const record& x, const record& y) noexcept -> bool {
+#define EQUAL(name, type) (x.name == y.name) &&
+        return WIDE_MEMBERS(EQUAL) true;
+#undef EQUAL
+    }
+
+    static void
+    serialize(std::byte* out, const record& x) noexcept {
+#define PUT(name, type) put(out, x.name);
+        WIDE_MEMBERS(PUT)
+#undef PUT
+    }
+
+    static void
+    transpose(std::span<const record> rows, columns& c) noexcept {
+        for(auto i = std::size_t{0}; i != rows.size(); ++i) {
+#define COPY(name, type) c.name[i] = rows[i].name;
+            WIDE_MEMBERS(COPY)
+#undef COPY
+        }
+    }
+};
+
+// Members of nested records.
+struct point {
+    float x, y;
+};
+
+struct interval {
+    std::int32_t low, high;
+};
+
+// Records with nested aggregates.
+struct nested_record {
+    std::uint64_t id;
+    point from, to;
+    interval range;
+    char tag;
+};
+
+// Columns of nested records, and hand-written operations on them.
+struct nested_shape {
+    using record = nested_record;
+
+    struct columns {
+        std::vector<std::uint64_t> id;
+        std::vector<point> from, to;
+        std::vector<interval> range;
+        std::vector<char> tag;
+    };
+
+    static constexpr auto name = "nested";
+
+    static auto
+    make(std::size_t i) -> record {
+        auto f = static_cast<float>(i);
+        auto k = static_cast<std::int32_t>(i);
+        return {i, {f, f + 1}, {f + 2, f + 3}, {k, k + 10},
+                static_cast<char>('a' + i % 26)};
+    }
+
+    static auto
+    make_columns() -> columns {
+        return {std::vector<std::uint64_t>(record_count),
+                std::vector<point>(record_count),
+                std::vector<point>(record_count),
+                std::vector<interval>(record_count),
+                std::vector<char>(record_count)};
+    }
+
+    static auto
+    spans(columns& c) -> mirror::column_spans<record> {
+        return {c.id, c.from, c.to, c.range, c.tag};
+    }
+
+    static auto
+    visit(const record& x) noexcept -> std::uint64_t {
+        return digest(x.id) + digest(x.from.x) + digest(x.from.y) +
+               digest(x.to.x) + digest(x.to.y) + digest(x.range.low) +
+               digest(x.range.high) + digest(x.tag);
+    }
+
+    static auto
+    hash(const record& x) noexcept -> std::size_t {
+        // Intervals have unique object representations, so they are hashed
+        // as a whole.
+        auto h = mirror::detail::hash_seed;
+        h = mix_bytes(h, x.id);
+        h = mix(h, x.from.x);
+        h = mix(h, x.from.y);
+        h = mix(h, x.to.x);
+        h = mix(h, x.to.y);
+        h = mix_bytes(h, x.range);
+        h = mix_bytes(h, x.tag);
+
+        return mirror::detail::hash_finalize(h);
+    }
+
+    static auto
+    equal(const record& x, const record& y) noexcept -> bool {
+        return (x.id == y.id) && (x.from.x == y.from.x) &&
+               (x.from.y == y.from.y) && (x.to.x == y.to.x) &&
+               (x.to.y == y.to.y) && (x.range.low == y.range.low) &&
+               (x.range.high == y.range.high) && (x.tag == y.tag);
+    }
+
+    static void
+    serialize(std::byte* out, const record& x) noexcept {
+        put(out, x.id);
+        put(out, x.from.x);
+        put(out, x.from.y);
+        put(out, x.to.x);
+        put(out, x.to.y);
+        put(out, x.range.low);
+        put(out, x.range.high);
+        put(out, x.tag);
+    }
+
+    static void
+    transpose(std::span<const record> rows, columns& c) noexcept {
+        for(auto i = std::size_t{0}; i != rows.size(); ++i) {
+            c.id[i] = rows[i].id;
+            c.from[i] = rows[i].from;
+            c.to[i] = rows[i].to;
+            c.range[i] = rows[i].range;
+            c.tag[i] = rows[i].tag;
+        }
+    }
+};
+
+// Records with strings and vectors. Such records are not trivially copyable,
+// hence they can not be serialized.
+struct text_record {
+    std::int64_t id;
+    std::string name;
+    std::vector<std::int32_t> values;
+};
+
+// Columns of records with strings and vectors, and hand-written operations on
+// them.
+struct text_shape {
+    using record = text_record;
+
+    struct columns {
+        std::vector<std::int64_t> id;
+        std::vector<std::string> name;
+        std::vector<std::vector<std::int32_t>> values;
+    };
+
+    static constexpr auto name = "strings";
+
+    static auto
+    make(std::size_t i) -> record {
+        auto k = static_cast<std::int32_t>(i);
+        return {k, "record " + std::to_string(i * 7919),
+                std::vector<std::int32_t>(i % 16, k)};
+    }
+
+    static auto
+    make_columns() -> columns {
+        return {std::vector<std::int64_t>(record_count),
+                std::vector<std::string>(record_count),
+                std::vector<std::vector<std::int32_t>>(record_count)};
+    }
+
+    static auto
+    spans(columns& c) -> mirror::column_spans<record> {
+        return {c.id, c.name, c.values};
+    }
+
+    static auto
+    visit(const record& x) noexcept -> std::uint64_t {
+        return digest(x.id) + digest(x.name) + digest(x.values);
+    }
+
+    static auto
+    hash(const record& x) noexcept -> std::size_t {
+        // Vectors are hashed element-wise, followed by their sizes.
+        auto h = mirror::detail::hash_seed;
+        h = mix_bytes(h, x.id);
+        h = mix(h, x.name);
+
+        for(auto value : x.values) {
+            h = mix_bytes(h, value);
+        }
+
+        h = mirror::detail::hash_round(h, x.values.size());
+        return mirror::detail::hash_finalize(h);
+    }
+
+    static auto
+    equal(const record& x, const record& y) noexcept -> bool {
+        return (x.id == y.id) && (x.name == y.name) && (x.values == y.values);
+    }
+
+    static void
+    serialize(std::byte*, const record&) noexcept {
+    }
+
+    static void
+    transpose(std::span<const record> rows, columns& c) {
+        for(auto i = std::size_t{0}; i != rows.size(); ++i) {
+            c.id[i] = rows[i].id;
+            c.name[i] = rows[i].name;
+            c.values[i] = rows[i].values;
+        }
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Benchmarks.
+////////////////////////////////////////////////////////////////////////////////
+
+// Computes a digest of the given object with reflection, recursively
+// descending into members of reflexible types.
+template <typename T>
+auto
+reflected_digest(const T& x) noexcept -> std::uint64_t {
+    if constexpr(mirror::reflexible<T>) {
+        auto r = std::uint64_t{};
+        mirror::for_each_member(
+            x, [&r](auto& member) { r += reflected_digest(member); });
+
+        return r;
+    } else {
+        return digest(x);
+    }
+}
+
+// Checks if the given values are equal, comparing values of reflexible types
+// member-wise.
+constexpr auto equal_values = [](const auto& x, const auto& y) {
+    if constexpr(mirror::reflexible<std::decay_t<decltype(x)>>) {
+        return mirror::equal(x, y);
+    } else {
+        return x == y;
+    }
+};
+
+// Measures operations on records of the given shape.
+template <typename Shape>
+void
+run() {
+    using record = typename Shape::record;
+
+    auto rows = std::vector<record>{};
+    for(auto i = std::size_t{0}; i != record_count; ++i) {
+        rows.push_back(Shape::make(i));
+    }
+
+    auto copies = rows;
+    auto name = Shape::name;
+
+    // Visitation.
+    for(auto& x : rows) {
+        check(reflected_digest(x) == Shape::visit(x), name, "visit");
+    }
+
+    measure(name, "visit", "mirror", record_count, sizeof(record), [&] {
+        auto r = std::uint64_t{};
+        for(auto& x : rows) {
+            r += reflected_digest(x);
+        }
+
+        return r;
+    });
+
+    measure(name, "visit", "baseline", record_count, sizeof(record), [&] {
+        auto r = std::uint64_t{};
+        for(auto& x : rows) {
+            r += Shape::visit(x);
+        }
+
+        return r;
+    });
+
+    // Hashing.
+    if constexpr(mirror::hashable<record>) {
+        for(auto& x : rows) {
+            check(mirror::hash(x) == Shape::hash(x), name, "hash");
+        }
+
+        measure(name, "hash", "mirror", record_count, sizeof(record), [&] {
+            auto r = std::size_t{};
+            for(auto& x : rows) {
+                r += mirror::hash(x);
+            }
+
+            return r;
+        });
+
+        measure(name, "hash", "baseline", record_count, sizeof(record), [&] {
+            auto r = std::size_t{};
+            for(auto& x : rows) {
+                r += Shape::hash(x);
+            }
+
+            return r;
+        });
+    } else {
+        omit(name, "hash", "the record is not hashable");
+    }
+
+    // Comparison.
+    for(auto i = std::size_t{0}; i != record_count; ++i) {
+        check(mirror::equal(rows[i], copies[i]) &&
+                  Shape::equal(rows[i], copies[i]) &&
+                  (mirror::equal(rows[i], rows[(i + 1) % record_count]) ==
+                   Shape::equal(rows[i], rows[(i + 1) % record_count])),
+              name, "compare");
+    }
+
+    measure(name, "compare", "mirror", record_count, sizeof(record), [&] {
+        auto r = std::size_t{};
+        for(auto i = std::size_t{0}; i != record_count; ++i) {
+            r += mirror::equal(rows[i], copies[i]) ? 1 : 0;
+        }
+
+        return r;
+    });
+
+    measure(name, "compare", "baseline", record_count, sizeof(record), [&] {
+        auto r = std::size_t{};
+        for(auto i = std::size_t{0}; i != record_count; ++i) {
+            r += Shape::equal(rows[i], copies[i]) ? 1 : 0;
+        }
+
+        return r;
+    });
+
+    // Serialization.
+    if constexpr(mirror::serializable<record>) {
+        constexpr auto size = mirror::serialized_size<record>;
+        auto buffer = std::vector<std::byte>(record_count * size);
+        auto expected = buffer;
+
+        for(auto i = std::size_t{0}; i != record_count; ++i) {
+            mirror::serialize(std::span{buffer}.subspan(i * size), rows[i]);
+            Shape::serialize(expected.data() + i * size, rows[i]);
+        }
+
+        check(buffer == expected, name, "serialize");
+
+        measure(name, "serialize", "mirror", record_count, size, [&] {
+            auto out = std::span{buffer};
+            for(auto& x : rows) {
+                out = out.subspan(mirror::serialize(out, x));
+            }
+
+            return buffer[0];
+        });
+
+        measure(name, "serialize", "baseline", record_count, size, [&] {
+            auto out = buffer.data();
+            for(auto& x : rows) {
+                Shape::serialize(out, x);
+                out += size;
+            }
+
+            return buffer[0];
+        });
+    } else {
+        omit(name, "serialize", "the record is not trivially copyable");
+    }
+
+    // Transposition to columns.
+    auto columns = Shape::make_columns();
+    auto expected = Shape::make_columns();
+
+    mirror::transpose_to_columns(
+        std::span<const record>{rows}, Shape::spans(columns));
+    Shape::transpose(rows, expected);
+
+    auto equal_columns = [&]<std::size_t... Indices>(
+                             std::index_sequence<Indices...>) {
+        auto x = Shape::spans(columns);
+        auto y = Shape::spans(expected);
+
+        return (std::equal(std::get<Indices>(x).begin(),
+                           std::get<Indices>(x).end(),
+                           std::get<Indices>(y).begin(), equal_values) &&
+                ...);
+    };
+
+    check(equal_columns(
+              std::make_index_sequence<mirror::data_member_count<record>>{}),
+          name, "transpose");
+
+    auto spans = Shape::spans(columns);
+
+    measure(name, "transpose", "mirror", record_count, sizeof(record), [&] {
+        return mirror::transpose_to_columns(
+            std::span<const record>{rows}, spans);
+    });
+
+    measure(name, "transpose", "baseline", record_count, sizeof(record), [&] {
+        Shape::transpose(rows, columns);
+        return std::get<0>(spans).data();
+    });
+}
+
+} // namespace
+
+int
+main(int argc, char* argv[]) {
+    if(argc > 1) {
+        min_duration = std::chrono::milliseconds{std::atoi(argv[1])};
+    }
+
+    std::printf("shape\toperation\timplementation\tns_per_op\tbytes_per_s"
+                "\tinstructions_per_op\n");
+
+    run<small_shape>();
+    run<wide_shape>();
+    run<nested_shape>();
+    run<text_shape>();
+}
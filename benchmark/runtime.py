@@ -0,0 +1,190 @@
+# Copyright Nezametdinov E. Ildus 2022.
+# Distributed under the Boost Software License, Version 1.0.
+# (See accompanying file LICENSE_1_0.txt or copy at
+# https://www.boost.org/LICENSE_1_0.txt)
+#
+# Measures run time of operations which use the library against hand-written
+# equivalents, and tracks regressions between runs.
+#
+import argparse
+import hashlib
+import json
+import os
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+
+# Parse command line arguments.
+parser = argparse.ArgumentParser()
+parser.add_argument(\
+    "--compilers",\
+    help = "compilers to benchmark (default: g++ and clang++, if found)",\
+    nargs = '+',\
+    default = [c for c in ["g++", "clang++"] if shutil.which(c)])
+parser.add_argument(\
+    "--levels",\
+    help = "optimization levels with which the benchmark is compiled, without"\
+           " the leading dash (default: O2 and O0)",\
+    nargs = '+',\
+    default = ["O2", "O0"])
+parser.add_argument(\
+    "--limit",\
+    help = "limit with which headers are generated",\
+    type = int,\
+    default = 127)
+parser.add_argument(\
+    "--time",\
+    help = "minimum duration of each measurement in milliseconds",\
+    type = int,\
+    default = 100)
+parser.add_argument(\
+    "--output",\
+    help = "name of the file to which results are written in JSON format")
+parser.add_argument(\
+    "--baseline",\
+    help = "name of the file with results of a previous run, with which"\
+           " results are compared")
+parser.add_argument(\
+    "--threshold",\
+    help = "increase (in percent) of the ratio of run time of the library to"\
+           " run time of hand-written code relative to the previous run which"\
+           " is reported as a regression",\
+    type = float,\
+    default = 20)
+
+args = parser.parse_args()
+
+# Directory which contains the repository.
+root = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+
+# Returns the digest of the headers in the given directory. Results of runs
+# with different digests were obtained with different generated code.
+def digest_headers(directory):
+    digest = hashlib.sha256()
+    for name in sorted(os.listdir(directory)):
+        with open(os.path.join(directory, name), 'rb') as file:
+            digest.update(name.encode() + b"\0" + file.read())
+
+    return digest.hexdigest()[:16]
+
+# Compiles and runs the benchmark, and returns the parsed results.
+def run(compiler, level, directory):
+    executable = os.path.join(directory, "runtime")
+    command = [compiler, "-std=c++20", f"-{level}", "-I", directory,\
+               os.path.join(root, "benchmark", "runtime.cc"), "-o", executable]
+
+    process = subprocess.run(command, capture_output = True, text = True)
+    if process.returncode != 0:
+        sys.exit(f"Error: {compiler} failed to compile the benchmark:\n"\
+                 f"{process.stderr}")
+
+    process = subprocess.run(\
+        [executable, str(args.time)], capture_output = True, text = True)
+    if process.returncode != 0:
+        sys.exit(f"Error: the benchmark failed:\n{process.stderr}")
+
+    # The first line of the output is the header of the table. Lines which
+    # start with # show operations which are not measured, and why.
+    lines = process.stdout.splitlines()[1:]
+    for line in [line for line in lines if line.startswith("#")]:
+        print(f"{compiler:>10} -{level:<2} {line[1:].strip()}".replace(\
+            "\t", " "))
+
+    results = []
+    for shape, operation, implementation, ns, bytes_per_s, instructions in\
+            [line.split("\t") for line in lines if not line.startswith("#")]:
+        results.append({"shape": shape, "operation": operation,\
+                        "implementation": implementation,\
+                        "ns_per_op": float(ns),\
+                        "bytes_per_s": float(bytes_per_s),\
+                        "instructions_per_op":\
+                            None if instructions == "-" else\
+                            float(instructions)})
+
+    return results
+
+# Returns the key which identifies the given result between runs.
+def key(result):
+    return (result["compiler"], result["level"], result["shape"],\
+            result["operation"], result["implementation"])
+
+# Load the results of the previous run.
+previous, previous_digest = {}, None
+if args.baseline:
+    with open(args.baseline, 'r') as file:
+        data = json.load(file)
+
+    previous = {key(r): r for r in data["results"]}
+    previous_digest = data["headers"]
+
+# Run the benchmarks.
+results, regressions = [], []
+with tempfile.TemporaryDirectory() as directory:
+    # Generate the headers with the given limit.
+    subprocess.run(\
+        [sys.executable, os.path.join(root, "meta.py"),\
+         os.path.join(root, "meta"), directory, str(args.limit)],\
+        check = True)
+
+    # Headers which are not generated are copied from the source directory, so
+    # that they include the generated ones.
+    for name in os.listdir(os.path.join(root, "src")):
+        if not os.path.exists(os.path.join(directory, name)) and\
+                not re.fullmatch(r"mirror_\d+\.hh", name):
+            shutil.copy(os.path.join(root, "src", name), directory)
+
+    headers = digest_headers(directory)
+
+    if previous_digest is not None:
+        print(f"headers {headers}, previous run: {previous_digest}"\
+              f" ({'same' if headers == previous_digest else 'changed'})")
+
+    for compiler in args.compilers:
+        for level in args.levels:
+            current = run(compiler, level, directory)
+            for r in current:
+                r.update({"compiler": compiler, "level": level})
+
+            # Ratios of run time of the library to run time of hand-written
+            # code are less sensitive to the machine than run time itself.
+            baselines = {(r["shape"], r["operation"]): r["ns_per_op"]\
+                         for r in current if r["implementation"] == "baseline"}
+
+            for r in current:
+                if r["implementation"] == "mirror":
+                    r["ratio"] = r["ns_per_op"] /\
+                        baselines[(r["shape"], r["operation"])]
+
+                # Regressions are detected by comparing the ratios with the
+                # ones of the previous run.
+                change = ""
+                if "ratio" in r and "ratio" in previous.get(key(r), {}):
+                    p = previous[key(r)]["ratio"]
+                    delta = 100 * (r["ratio"] - p) / p
+                    change = f" {delta:+7.1f}%"
+
+                    if delta > args.threshold:
+                        change += " REGRESSION"
+                        regressions.append(r)
+
+                instructions = r["instructions_per_op"]
+                instructions = "-" if instructions is None else instructions
+                print(f"{compiler:>10} -{level:<2} {r['shape']:>7}"\
+                      f" {r['operation']:>9} {r['implementation']:>8}:"\
+                      f" {r['ns_per_op']:10.2f} ns"\
+                      f" {r['bytes_per_s'] / 1e9:8.2f} GB/s"\
+                      f" {instructions:>8} instructions" +\
+                      (f" {r['ratio']:6.2f}x" if "ratio" in r else " " * 8) +\
+                      change)
+
+            results += current
+
+if args.output:
+    with open(args.output, 'w') as file:
+        json.dump({"headers": headers, "results": results}, file, indent = 4)
+
+if regressions:
+    sys.exit(f"Error: {len(regressions)} measurements regressed by more than"\
+             f" {args.threshold}%")
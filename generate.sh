@@ -61,5 +61,9 @@ SpaceBeforeParens: Never,\
 SortIncludes: false,\
 DisableFormat: false}"
 
-python3 meta.py meta/mirror.hh src/mirror.hh $1
-clang-format --style="${STYLE}" -i src/mirror.hh
+python3 meta.py meta src $1
+
+# Only the generated headers are formatted: the rest of the headers are written
+# by hand.
+clang-format --style="${STYLE}" -i \
+    src/mirror.hh src/mirror_core.hh src/mirror_[0-9]*.hh
@@ -0,0 +1,145 @@
+# Copyright Nezametdinov E. Ildus 2022.
+# Distributed under the Boost Software License, Version 1.0.
+# (See accompanying file LICENSE_1_0.txt or copy at
+# https://www.boost.org/LICENSE_1_0.txt)
+#
+# Generates a header with member count hints for the given types. The header
+# pins the number of non-static data members in each type, so translation units
+# which include it verify the count with two probes instead of running the full
+# search.
+#
+# Example:
+#     python3 hints.py -I src -I include --header messages.hh \
+#         --type net::message --type net::header messages_hints.hh
+#
+# With the --stats option the script writes counting statistics of the types
+# instead: numbers of probes which the search makes, and the greatest number of
+# arguments in a probe. These show which types drive the compilation cost.
+#
+import argparse
+import os
+import subprocess
+import sys
+import tempfile
+import uuid
+
+# Parse command line arguments.
+parser = argparse.ArgumentParser()
+parser.add_argument("output", help = "output file name")
+parser.add_argument(\
+    "--header",\
+    help = "header which defines the types (can be repeated)",\
+    action = "append",\
+    required = True)
+parser.add_argument(\
+    "--type",\
+    help = "fully qualified name of the type (can be repeated)",\
+    action = "append",\
+    required = True)
+parser.add_argument(\
+    "-I",\
+    help = "include directory (can be repeated)",\
+    dest = "include_dirs",\
+    action = "append",\
+    default = [])
+parser.add_argument(\
+    "--stats",\
+    help = "write counting statistics instead of hints",\
+    action = "store_true")
+parser.add_argument(\
+    "--compiler",\
+    help = "C++ compiler which is used to count members",\
+    default = os.environ.get("CXX", "c++"))
+
+args = parser.parse_args()
+
+# Returns the list of include directives for the headers which define types.
+def include_directives():
+    return [f"#include \"{name}\"" for name in args.header]
+
+# Names of fields of counting statistics which are written in the --stats mode.
+stats_fields = ["member_count", "probe_count", "gallop_probe_count",\
+                "bisect_probe_count", "max_probe_size", "is_hinted",\
+                "is_braced", "is_reflectable"]
+
+# Returns the statement which prints the counting data of the given type on a
+# separate line.
+def print_statement(name):
+    if not args.stats:
+        return f"    std::printf(\"%zu\\n\", mirror::data_member_count<{name}>);"
+
+    stats = f"mirror::counting_stats_of<{name}>"
+    return "    std::printf(\"" + " ".join(["%zu"] * len(stats_fields)) +\
+        "\\n\", " + ", ".join([f"std::size_t{{{stats}.{field}}}"\
+                                for field in stats_fields]) + ");"
+
+# Obtains counting data of the types by compiling and running a program which
+# prints the data of each type on a separate line. Returns the list of lines.
+def count_members():
+    program = "\n".join(\
+        (["#define MIRROR_ENABLE_STATS"] if args.stats else []) +\
+        ["#include \"mirror.hh\""] + include_directives() +\
+        ["#include <cstdio>", "", "int", "main() {"] +\
+        [print_statement(name) for name in args.type] +\
+        ["}", ""])
+
+    with tempfile.TemporaryDirectory() as directory:
+        source_name = os.path.join(directory, "hints.cc")
+        binary_name = os.path.join(directory, "hints")
+
+        with open(source_name, 'w') as file:
+            file.write(program)
+
+        subprocess.run([args.compiler, "-std=c++20", "-o", binary_name,\
+                        source_name] +\
+                       [f"-I{name}" for name in args.include_dirs],\
+                       check = True)
+
+        result = subprocess.run([binary_name], check = True,\
+                                capture_output = True, text = True)
+
+        return result.stdout.splitlines()
+
+# Writes the header with hints for the given counts.
+def generate(counts):
+    guard = uuid.uuid5(uuid.NAMESPACE_OID,\
+                       os.path.basename(args.output)).hex.upper()
+
+    with open(args.output, 'w') as file:
+        lines = [\
+            "// This file was generated by hints.py, do not edit.",\
+            "//",\
+            f"#ifndef H_{guard}",\
+            f"#define H_{guard}",\
+            "",\
+            "#include \"mirror_core.hh\""] + include_directives() + [""]
+
+        for name, n in zip(args.type, counts):
+            lines += [\
+                "template <>",\
+                f"constexpr auto mirror::member_count_hint<{name}> ="\
+                f" std::size_t{{{int(n)}}};",\
+                ""]
+
+        lines += [f"#endif // H_{guard}"]
+        print("\n".join(lines), file=file)
+
+# Writes the table of counting statistics. Types are sorted by the number of
+# probes, in descending order.
+def generate_stats(lines):
+    rows = sorted([[name] + [int(v) for v in line.split()]\
+                   for name, line in zip(args.type, lines)],\
+                  key = lambda row: -row[2])
+
+    with open(args.output, 'w') as file:
+        print("\t".join(["type"] + stats_fields), file=file)
+        for row in rows:
+            print("\t".join([str(v) for v in row]), file=file)
+
+try:
+    if args.stats:
+        generate_stats(count_members())
+    else:
+        generate(count_members())
+except subprocess.CalledProcessError as error:
+    sys.exit(f"Error: {error}")
@@ -4,11 +4,14 @@
 # https://www.boost.org/LICENSE_1_0.txt)
 #
 import argparse
+import os
+import re
+import uuid
 
 # Parse command line arguments.
 parser = argparse.ArgumentParser()
-parser.add_argument("input", help = "input file name")
-parser.add_argument("output", help = "output file name")
+parser.add_argument("input", help = "input directory name")
+parser.add_argument("output", help = "output directory name")
 parser.add_argument(\
     "limit",\
     help = "maximum number of non-static data members in types",\
@@ -18,58 +21,196 @@ parser.add_argument(\
 
 args = parser.parse_args()
 
-# Read the input file to a string.
-source_code = ""
-with open(args.input, 'r') as file:
-    source_code = "\n".join([line.rstrip() for line in file])
-
-# Generate output file.
-with open(args.output, 'w') as file:
-    # Writes the string to the file.
-    def write(string):
-        print(string, file=file)
-
-    # Writes maximum number of non-static data members in types to the file.
-    def limit():
-        write(args.limit)
-
-    # Writes view_as_tuple specializations to the file.
-    def generate_specializations():
-        for n in range(1, args.limit+1):
-            # Generate comma-separated list of variables with different names.
-            variables = ", ".join([f"e{i:0>2X}" for i in range(0, n)])
-
-            # Write function definition.
-            write(f"else if constexpr(data_member_count<T> == {n}) {{")
-            write(f"// Obtain references to member objects using structural"\
-                  f" bindings.")
-            write(f"auto& [{variables}] = x;")
-            write("")
-            write(f"// Construct a tuple from these references.")
-            write(f"return std::tie({variables});")
-            write(f"}}")
-
-    # Find the first template parameter in the input file's source code.
-    i, j = (source_code.find("(@"), source_code.find("@)"))
-
-    # Write the output file by substituting template parameters in the input
-    # file's source code.
-    while i != -1:
-        if i > j:
-            raise RuntimeError("Error: syntax error in input file")
-
-        # Write the part of the source code which comes before template
-        # parameter.
-        write(source_code[:i])
-
-        # Execute the template parameter.
-        globals()[source_code[i+2:j]]()
-
-        # Shrink the source code.
-        source_code = source_code[j+2:]
-
-        # Find the next template parameter in the remaining source code.
+# Limits of the tiered headers. Each tiered header supports types with up to
+# the given number of non-static data members, and includes the previous tier.
+# The last tier always has the limit given in the command line.
+tiers = [n for n in [32, 64, 256, 1024] if n < args.limit] + [args.limit]
+
+# Name of the template of tiered headers in the input directory.
+tier_template = "mirror_tier.hh"
+
+# Returns the name of the tiered header with the given limit.
+def tier_name(n):
+    return f"mirror_{n}.hh"
+
+# Generates the output file from the given input file. The tier is a pair of
+# the first and the last number of non-static data members which are supported
+# by the output file.
+def generate(input_name, output_name, tier):
+    # Read the input file to a string.
+    source_code = ""
+    with open(input_name, 'r') as file:
+        source_code = "\n".join([line.rstrip() for line in file])
+
+    # Generate output file.
+    with open(output_name, 'w') as file:
+        # Writes the string to the file.
+        def write(string):
+            file.write(str(string))
+
+        # Writes the string followed by a line break to the file.
+        def write_line(string = ""):
+            print(string, file=file)
+
+        # Writes maximum number of non-static data members in types to the
+        # file.
+        def limit():
+            write(tier[1])
+
+        # Writes the unique part of the include guard to the file.
+        def guard():
+            write(uuid.uuid5(uuid.NAMESPACE_OID, os.path.basename(\
+                output_name)).hex.upper())
+
+        # Writes the comma-separated list of names of the generated tiered
+        # headers to the file.
+        def tier_names():
+            write(", ".join([tier_name(n) for n in tiers]))
+
+        # Writes the name of the header on which the generated code depends to
+        # the file.
+        def base():
+            write(tier_name(tier[0] - 1) if tier[0] != 1 else "mirror_core.hh")
+
+        # Writes reflector specializations to the file.
+        def generate_specializations():
+            for n in range(tier[0], tier[1]+1):
+                # Generate comma-separated lists of variables with different
+                # names.
+                names = [[f"{c}{i:0>2X}" for i in range(0, n)] for c in "exy"]
+                variables, x_variables, y_variables =\
+                    [", ".join(names[k]) for k in range(3)]
+
+                # Write class template specialization.
+                write_line(f"template <>")
+                write_line(f"struct reflector<{n}> {{")
+                write_line(f"template <typename T>")
+                write_line(f"static constexpr auto")
+                write_line(f"tie(T& x) noexcept {{")
+                write_line(f"// Obtain references to member objects using"\
+                           f" structural bindings.")
+                write_line(f"auto& [{variables}] = x;")
+                write_line("")
+                write_line(f"// Construct a tuple from these references.")
+                write_line(f"return std::tie({variables});")
+                write_line(f"}}")
+                write_line("")
+
+                # Write type computation function.
+                types = ", ".join([f"decltype({v})" for v in names[0]])
+                write_line(f"template <typename T>")
+                write_line(f"static constexpr auto")
+                write_line(f"types(T& x) noexcept {{")
+                write_line(f"// Obtain references to member objects using"\
+                           f" structural bindings.")
+                write_line(f"auto& [{variables}] = x;")
+                write_line("")
+                write_line(f"// Construct a list of declared types of the"\
+                           f" members.")
+                write_line(f"return type_list<{types}>{{}};")
+                write_line(f"}}")
+                write_line("")
+
+                # Write bit-field detection function.
+                write_line(f"template <typename T>")
+                write_line(f"static constexpr auto")
+                write_line(f"has_bit_fields(T& x) noexcept {{")
+                write_line(f"// Obtain references to member objects using"\
+                           f" structural bindings.")
+                write_line(f"auto& [{variables}] = x;")
+                write_line("")
+                write_line(f"// Check if addresses of the members can be"\
+                           f" taken: this is not")
+                write_line(f"// the case for bit-fields.")
+                write_line(f"return std::bool_constant<!requires {{")
+                for v in names[0]:
+                    write_line(f"&{v};")
+                write_line(f"}}>{{}};")
+                write_line(f"}}")
+                write_line("")
+
+                # Write visitation functions.
+                write_line(f"template <typename T, typename F>")
+                write_line(f"static constexpr void")
+                write_line(f"visit(T& x, F& f) {{")
+                write_line(f"// Obtain references to member objects using"\
+                           f" structural bindings.")
+                write_line(f"auto& [{variables}] = x;")
+                write_line("")
+                write_line(f"// Invoke the function with each reference.")
+                for v in names[0]:
+                    write_line(f"f({v});")
+                write_line(f"}}")
+                write_line("")
+
+                write_line(f"template <typename T, typename F>")
+                write_line(f"static constexpr void")
+                write_line(f"visit_indexed(T& x, F& f) {{")
+                write_line(f"// Obtain references to member objects using"\
+                           f" structural bindings.")
+                write_line(f"auto& [{variables}] = x;")
+                write_line("")
+                write_line(f"// Invoke the function with each index and"\
+                           f" reference.")
+                for i, v in enumerate(names[0]):
+                    write_line(f"f(index<{i}>{{}}, {v});")
+                write_line(f"}}")
+                write_line("")
+
+                write_line(f"template <typename T, typename U, typename F>")
+                write_line(f"static constexpr void")
+                write_line(f"visit(T& x, U& y, F& f) {{")
+                write_line(f"// Obtain references to member objects using"\
+                           f" structural bindings.")
+                write_line(f"auto& [{x_variables}] = x;")
+                write_line(f"auto& [{y_variables}] = y;")
+                write_line("")
+                write_line(f"// Invoke the function with each pair of"\
+                           f" references.")
+                for x, y in zip(names[1], names[2]):
+                    write_line(f"f({x}, {y});")
+                write_line(f"}}")
+                write_line(f"}};")
+                write_line("")
+
+        # Find the first template parameter in the input file's source code.
         i, j = (source_code.find("(@"), source_code.find("@)"))
 
-    # Write the remaining source code.
-    write(source_code)
+        # Write the output file by substituting template parameters in the
+        # input file's source code.
+        while i != -1:
+            if i > j:
+                raise RuntimeError("Error: syntax error in input file")
+
+            # Write the part of the source code which comes before template
+            # parameter.
+            write(source_code[:i])
+
+            # Execute the template parameter.
+            locals()[source_code[i+2:j]]()
+
+            # Shrink the source code.
+            source_code = source_code[j+2:]
+
+            # Find the next template parameter in the remaining source code.
+            i, j = (source_code.find("(@"), source_code.find("@)"))
+
+        # Write the remaining source code.
+        write_line(source_code)
+
+# Remove tiered headers which might have been generated with another limit.
+for name in os.listdir(args.output):
+    if re.fullmatch(r"mirror_\d+\.hh", name):
+        os.remove(os.path.join(args.output, name))
+
+# Generate tiered headers.
+for first, last in zip([1] + [n + 1 for n in tiers[:-1]], tiers):
+    generate(os.path.join(args.input, tier_template),\
+             os.path.join(args.output, tier_name(last)), (first, last))
+
+# Generate the rest of the headers. These support types with up to the maximum
+# number of non-static data members.
+for name in sorted(os.listdir(args.input)):
+    if name != tier_template:
+        generate(os.path.join(args.input, name),\
+                 os.path.join(args.output, name), (1, args.limit))
@@ -0,0 +1,999 @@
+// Copyright Nezametdinov E. Ildus 2022.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef H_11C2AC75454C4974BF620FFAC33824B8
+#define H_11C2AC75454C4974BF620FFAC33824B8
+
+#include <climits>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+#include <array>
+#include <bit>
+#include <new>
+#include <utility>
+#include <tuple>
+#include <type_traits>
+
+namespace mirror {
+
+////////////////////////////////////////////////////////////////////////////////
+// A concept that models types which can be reflected.
+////////////////////////////////////////////////////////////////////////////////
+
+// Cv-qualified versions of reflexible types are also reflexible.
+//
+// clang-format off
+template <typename T>
+concept reflexible =
+    std::is_aggregate_v<T> &&
+    std::default_initializable<std::remove_cv_t<T>> &&
+    (std::copy_constructible<std::remove_cv_t<T>> ||
+     std::move_constructible<std::remove_cv_t<T>>);
+// clang-format on
+
+////////////////////////////////////////////////////////////////////////////////
+// Non-static data member counting.
+////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// Special type which is convertible to any other type, except for possibly
+// cv-qualified versions of itself and corresponding reference types.
+template <typename T, std::size_t I>
+struct universal {
+    template <typename U>
+    operator U() const noexcept
+        requires(!std::same_as<T, std::remove_cvref_t<U>>);
+};
+
+// A concept for a type which is constructible with a sequence of arguments. The
+// size of the sequence is the same as the size of the non-type template
+// parameter pack.
+template <typename T, std::size_t... Indices>
+concept constructible_from = requires {
+    T{std::declval<universal<T, Indices>>()...};
+};
+
+// A concept for a type which is constructible with a sequence of arguments,
+// each of which is enclosed in braces. Braces are not elided, so each argument
+// initializes exactly one non-static data member, even if the member is an
+// array (without braces elements of arrays are initialized by separate
+// arguments, so arrays would be counted element by element).
+template <typename T, std::size_t... Indices>
+concept brace_constructible_from = requires {
+    T{{std::declval<universal<T, Indices>>()}...};
+};
+
+// A concept for a type which is constructible with a sequence of arguments
+// enclosed in braces, followed by one more argument without braces. After the
+// search with arguments in braces this shows if there is a member which can
+// not be initialized with an argument in braces.
+template <typename T, std::size_t... Indices>
+concept brace_constructible_from_with_extra = requires {
+    T{{std::declval<universal<T, Indices>>()}...,
+      std::declval<universal<T, sizeof...(Indices)>>()};
+};
+
+// A predicate which shows if the given type is constructible with the given
+// number of arguments, which are enclosed in braces if the given flag is set.
+//
+// clang-format off
+template <typename T, std::size_t N, bool Is_braced = false>
+constexpr auto
+is_constructible =
+    []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+        if constexpr(Is_braced) {
+            return brace_constructible_from<T, Indices...>;
+        } else {
+            return constructible_from<T, Indices...>;
+        }
+    }(std::make_index_sequence<N>{});
+// clang-format on
+
+// A predicate which shows if the given type is constructible with the given
+// number of arguments enclosed in braces, followed by one more argument without
+// braces.
+//
+// clang-format off
+template <typename T, std::size_t N>
+constexpr auto
+is_constructible_with_extra =
+    []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+        return brace_constructible_from_with_extra<T, Indices...>;
+    }(std::make_index_sequence<N>{});
+// clang-format on
+
+// A median between two values.
+template <std::size_t L, std::size_t R>
+constexpr auto median = ((L / 2) + (R / 2) + ((1 + (L % 2) + (R % 2)) / 2));
+
+// Performs compile-time binary search. Probes use arguments in braces if the
+// given flag is set.
+template <typename T, std::size_t L, std::size_t M, std::size_t R,
+          bool Is_braced>
+constexpr auto
+bisect() noexcept -> std::size_t {
+    if constexpr(L == R) {
+        return L;
+    } else {
+        if constexpr(is_constructible<T, M, Is_braced>) {
+            return bisect<T, M, median<M, R>, R, Is_braced>();
+        } else {
+            return bisect<T, L, median<L, M - 1>, M - 1, Is_braced>();
+        }
+    }
+}
+
+// Finds an upper bound for binary search by probing exponentially growing
+// numbers of arguments. The type is known to be constructible with N / 2
+// arguments, and the number of its non-static data members never exceeds the
+// given limit.
+template <typename T, std::size_t N, std::size_t Limit, bool Is_braced>
+constexpr auto
+gallop() noexcept -> std::size_t {
+    constexpr auto l = std::size_t{N / 2};
+
+    if constexpr(N >= Limit) {
+        return bisect<T, l, median<l, Limit>, Limit, Is_braced>();
+    } else if constexpr(is_constructible<T, N, Is_braced>) {
+        return gallop<T, N * 2, Limit, Is_braced>();
+    } else {
+        return bisect<T, l, median<l, N - 1>, N - 1, Is_braced>();
+    }
+}
+
+// Value of the member count hint which shows that there is no hint.
+constexpr auto no_member_count_hint = ~std::size_t{0};
+
+} // namespace detail
+
+// A customization point which pins the number of non-static data members in
+// the given (cv-unqualified) type. A specialization must be visible wherever
+// the data_member_count of the type is used, so it should be declared right
+// after the type, e.g.:
+//
+//     template <>
+//     constexpr auto mirror::member_count_hint<message> = std::size_t{12};
+//
+// Hints are verified with a few probes instead of the full search (unless
+// members of the type are counted element by element), and incorrect hints
+// produce a diagnostic. The hints.py script generates hints for the given
+// types.
+template <typename T>
+constexpr auto member_count_hint = detail::no_member_count_hint;
+
+namespace detail {
+
+// A concept for types which define the tuple protocol, e.g. std::array.
+// Structured bindings of such types bind the elements of the tuple, rather than
+// non-static data members.
+template <typename T>
+concept tuple_like = requires { std::tuple_size<T>::value; };
+
+// Searches for the number of non-static data members in the given type, using
+// probes with arguments in braces if the given flag is set.
+template <typename T, bool Is_braced>
+constexpr auto
+search_member_count() noexcept -> std::size_t {
+    // Compute the size of the type in bits. This will be the upper bound for
+    // the search.
+    constexpr auto bit_size = std::size_t{sizeof(T) * CHAR_BIT};
+    static_assert(bit_size / sizeof(T) == CHAR_BIT);
+
+    // Run exponential search. This keeps the number of arguments in each probe
+    // proportional to the number of members, rather than to the size of the
+    // type.
+    return gallop<T, 1, bit_size, Is_braced>();
+}
+
+// A predicate which shows if non-static data members of the given type can be
+// counted with arguments in braces. This is the case if the member which
+// follows the counted members can not be initialized with an argument without
+// braces either, i.e. if there is no such member. Otherwise it can not be
+// initialized with an argument in braces (e.g. it is an object of an empty
+// class), and members are counted with arguments without braces, hence each
+// element of an array member is counted separately. Elements of tuple-like
+// types are always counted with arguments without braces.
+template <typename T>
+constexpr auto
+is_brace_countable() noexcept -> bool {
+    if constexpr(tuple_like<T>) {
+        return false;
+    } else {
+        return !is_constructible_with_extra<T, search_member_count<T, true>()>;
+    }
+}
+
+// Checks if the given type has the given number of non-static data members.
+// The number is first checked with arguments in braces, which succeeds for
+// brace-countable types with the correct number. Otherwise the number is only
+// checked with arguments without braces if the type is not brace-countable:
+// such probes count each element of an array member separately, so they would
+// accept incorrect numbers for brace-countable types.
+template <typename T, std::size_t N>
+constexpr auto
+is_member_count() noexcept -> bool {
+    if constexpr(!tuple_like<T> && is_constructible<T, N, true> &&
+                 !is_constructible<T, N + 1, true> &&
+                 !is_constructible_with_extra<T, N>) {
+        return true;
+    } else if constexpr(is_brace_countable<T>()) {
+        return false;
+    } else {
+        return is_constructible<T, N> && !is_constructible<T, N + 1>;
+    }
+}
+
+// Counts the number of non-static data members in the given type. Searching
+// with arguments in braces counts each array member once, and does not depend
+// on the number of its elements.
+template <typename T>
+constexpr auto
+count_data_members() noexcept {
+    if constexpr(constexpr auto n = std::size_t{member_count_hint<T>};
+                 n != no_member_count_hint) {
+        static_assert(is_member_count<T, n>(),
+                      "The member count hint does not match the type.");
+
+        return n;
+    } else {
+        return search_member_count<T, is_brace_countable<T>()>();
+    }
+}
+
+} // namespace detail
+
+// Count of the non-static data members in the given type.
+template <reflexible T>
+constexpr auto data_member_count =
+    detail::count_data_members<std::remove_cv_t<T>>();
+
+////////////////////////////////////////////////////////////////////////////////
+// Type lists.
+////////////////////////////////////////////////////////////////////////////////
+
+// A list of types.
+template <typename... Types>
+struct type_list {
+    static constexpr auto size = sizeof...(Types);
+};
+
+namespace detail {
+
+// An element of a type list, which is tagged with its index.
+template <std::size_t I, typename T>
+struct indexed_type {
+    using type = T;
+};
+
+// A class which derives from each element of the given type list, tagged with
+// its index. Allows selecting elements by index using overload resolution,
+// without recursive instantiation of templates.
+template <typename Indices, typename... Types>
+struct indexed_types;
+
+template <std::size_t... Indices, typename... Types>
+struct indexed_types<std::index_sequence<Indices...>, Types...>
+    : indexed_type<Indices, Types>... {};
+
+template <std::size_t I, typename T>
+auto
+select_type(const indexed_type<I, T>&) -> indexed_type<I, T>;
+
+// Type of the element with the given index in the given type list.
+template <std::size_t I, typename List>
+struct type_at;
+
+template <std::size_t I, typename... Types>
+struct type_at<I, type_list<Types...>> {
+    static_assert(I < sizeof...(Types), "The index is out of range.");
+
+    using type = typename decltype(select_type<I>(
+        indexed_types<std::index_sequence_for<Types...>, Types...>{}))::type;
+};
+
+// A predicate which shows if the given type is a specialization of the given
+// class template, e.g. of std::optional.
+template <typename T, template <typename...> typename Template>
+constexpr auto is_specialization_of = false;
+
+template <template <typename...> typename Template, typename... Types>
+constexpr auto is_specialization_of<Template<Types...>, Template> = true;
+
+} // namespace detail
+
+// Type of the element with the given index in the given type list.
+template <std::size_t I, typename List>
+using type_at_t = typename detail::type_at<I, List>::type;
+
+////////////////////////////////////////////////////////////////////////////////
+// Tuple construction.
+////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// Type of the argument which passes the index of a non-static data member to
+// functions which are invoked for each member.
+template <std::size_t I>
+using index = std::integral_constant<std::size_t, I>;
+
+// A class which obtains references to non-static data members of objects of
+// types with the given number of such members, and invokes functions with these
+// references. Each number has its own specialization, hence reflection of a
+// type instantiates only the specialization which corresponds to its number of
+// members. Specializations for non-zero numbers are defined in tiered headers.
+template <std::size_t N>
+struct reflector;
+
+template <>
+struct reflector<0> {
+    template <typename T>
+    static constexpr auto
+    tie(T&) noexcept {
+        return std::tuple<>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T&) noexcept {
+        return type_list<>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T&) noexcept {
+        return std::false_type{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T&, F&) {
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T&, F&) {
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T&, U&, F&) {
+    }
+};
+
+// A concept which holds if objects of types with the given number of
+// non-static data members can be reflected with the included headers.
+template <std::size_t N>
+concept has_reflector = requires { sizeof(reflector<N>); };
+
+// A predicate which shows if the given type has bit-fields. Only the types of
+// objects which can be reflected with the included headers are checked.
+template <typename T>
+constexpr auto has_bit_fields_of = [] {
+    if constexpr(has_reflector<data_member_count<T>>) {
+        return decltype(reflector<data_member_count<T>>::has_bit_fields(
+            std::declval<T&>()))::value;
+    } else {
+        return false;
+    }
+}();
+
+// A predicate which shows if objects of the given type can be reflected with
+// the included headers. Produces a diagnostic if they can not: either no tiered
+// header is included (feature headers only include the core header), or the
+// included one supports fewer members than the type has.
+template <typename T>
+constexpr auto is_reflectable = [] {
+    // Types without members need no tiered header. The check of the first
+    // tier depends on the type, so that it is made where the type is reflected.
+    constexpr auto has_tier = has_reflector<(data_member_count<T> != 0)>;
+
+    if constexpr(data_member_count<T> != 0) {
+        static_assert(has_tier,
+                      "No tiered header is included: include mirror.hh or a "
+                      "mirror_N.hh header before reflecting types.");
+
+        if constexpr(has_tier) {
+            static_assert(has_reflector<data_member_count<T>>,
+                          "The type has more non-static data members than the "
+                          "included tiered header supports: include mirror.hh "
+                          "or a tiered header with a greater limit, one of: "
+                          "(@tier_names@)"
+                          ". Otherwise generate headers with a greater limit.");
+        }
+    }
+
+    return has_reflector<data_member_count<T>>;
+}();
+
+// A predicate which shows if references to non-static data members of objects
+// of the given type can be obtained. Produces a diagnostic if they can not.
+template <typename T>
+constexpr auto is_bindable = [] {
+    static_assert(!has_bit_fields_of<T>,
+                  "The type has bit-fields, which can not be reflected: "
+                  "references to bit-fields can not be formed.");
+
+    return is_reflectable<T> && !has_bit_fields_of<T>;
+}();
+
+// Reflector for the given type.
+template <typename T>
+using reflector_of = reflector<data_member_count<T>>;
+
+} // namespace detail
+
+// Returns a tuple of references to non-static data members of the given object.
+// If the object is const, then the references are const.
+template <reflexible T>
+constexpr auto
+reflect(T& x) noexcept -> decltype(auto) {
+    if constexpr(detail::is_bindable<T>) {
+        return detail::reflector_of<T>::tie(x);
+    }
+}
+
+// Returns a tuple of rvalue references to non-static data members of the given
+// object, which can be used to move members out of it. The references are valid
+// as long as the object lives: for temporary objects, until the end of the full
+// expression.
+template <reflexible T>
+constexpr auto
+reflect(T&& x) noexcept -> decltype(auto) requires(!std::is_const_v<T>) {
+    return std::apply(
+        [](auto&... members) {
+            return std::forward_as_tuple(std::move(members)...);
+        },
+        reflect(x));
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Member types.
+////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// Returns a list of declared types of non-static data members of the given
+// object. Only the type of the result is used: the function is never called.
+template <typename T>
+constexpr auto
+member_types_of(T& x) noexcept {
+    if constexpr(is_reflectable<T>) {
+        return reflector_of<T>::types(x);
+    }
+}
+
+} // namespace detail
+
+// A list of types of non-static data members of the given type, in declaration
+// order. If the type is const, then so are the types of its members. Unlike
+// the type of the result of reflect, this is computed from structural bindings
+// without instantiating tuples.
+template <reflexible T>
+using member_types = decltype(detail::member_types_of(std::declval<T&>()));
+
+// Type of the non-static data member with the given index.
+template <reflexible T, std::size_t I>
+using member_type_t = type_at_t<I, member_types<T>>;
+
+////////////////////////////////////////////////////////////////////////////////
+// Member visitation.
+////////////////////////////////////////////////////////////////////////////////
+
+// Invokes the given function with each non-static data member of the given
+// object, in declaration order. Unlike reflect, this does not construct a
+// tuple.
+template <reflexible T, typename F>
+constexpr void
+for_each_member(T& x, F&& f) {
+    if constexpr(detail::is_bindable<T>) {
+        detail::reflector_of<T>::visit(x, f);
+    }
+}
+
+// Invokes the given function with the index (as std::integral_constant) and
+// the reference of each non-static data member of the given object.
+template <reflexible T, typename F>
+constexpr void
+for_each_member_indexed(T& x, F&& f) {
+    if constexpr(detail::is_bindable<T>) {
+        detail::reflector_of<T>::visit_indexed(x, f);
+    }
+}
+
+// Invokes the given function with each pair of corresponding non-static data
+// members of the given objects, which can be used to copy, compare or diff
+// them.
+template <reflexible T, reflexible U, typename F>
+constexpr void
+for_each_member(T& x, U& y, F&& f) requires(
+    std::same_as<std::remove_cv_t<T>, std::remove_cv_t<U>>) {
+    if constexpr(detail::is_bindable<T>) {
+        detail::reflector_of<T>::visit(x, y, f);
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Layout computation.
+////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// Rounds the given offset up to the given alignment.
+constexpr auto
+align_up(std::size_t offset, std::size_t alignment) noexcept -> std::size_t {
+    return ((offset + alignment - 1) / alignment) * alignment;
+}
+
+// Offsets of non-static data members in the given type. Offsets are computed
+// using the rules which compilers follow when laying out aggregates: each
+// member is placed at the first suitably aligned offset after the previous one.
+//
+// clang-format off
+template <typename T>
+constexpr auto
+member_offsets =
+    []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+        auto offsets = std::array<std::size_t, sizeof...(Indices)>{};
+        auto offset = std::size_t{0};
+
+        ((offsets[Indices] = offset =
+              align_up(offset, alignof(member_type_t<T, Indices>)),
+          offset += sizeof(member_type_t<T, Indices>)), ...);
+
+        return offsets;
+    }(std::make_index_sequence<data_member_count<T>>{});
+// clang-format on
+
+// A predicate which shows if the leading leaf of an object of the given type
+// can be reached: the first subobject which is not an array or an object of a
+// reflexible type with non-static data members, obtained through first
+// elements and first members. Such subobject is located at the beginning of
+// the object.
+template <typename T>
+constexpr auto has_leading_leaf = [] {
+    if constexpr(std::is_array_v<T>) {
+        return has_leading_leaf<std::remove_cv_t<std::remove_extent_t<T>>>;
+    } else if constexpr(!reflexible<T>) {
+        return true;
+    } else if constexpr(data_member_count<T> == 0) {
+        return true;
+    } else if constexpr(has_bit_fields_of<T>) {
+        return false;
+    } else {
+        return has_leading_leaf<std::remove_cv_t<member_type_t<T, 0>>>;
+    }
+}();
+
+// Returns the reference to the leading leaf of the given object.
+template <typename T>
+constexpr auto
+leading_leaf_of(T& x) noexcept -> auto& {
+    if constexpr(std::is_array_v<T>) {
+        return leading_leaf_of(x[0]);
+    } else if constexpr(!reflexible<T>) {
+        return x;
+    } else if constexpr(data_member_count<T> == 0) {
+        return x;
+    } else {
+        return leading_leaf_of(std::get<0>(reflector_of<T>::tie(x)));
+    }
+}
+
+// Checks if the computed offset of the non-static data member with the given
+// index is its actual offset: an object is constructed from bytes which are
+// all zero except for the byte at the computed offset, and the first byte of
+// the member is read back. Offsets of empty members are not checked, since
+// they have no bytes to read: misplacement of such members shows in offsets of
+// the next members, or in the size of the object.
+template <typename T, std::size_t I>
+constexpr auto
+is_member_offset_verified() noexcept -> bool {
+    auto bytes = std::array<unsigned char, sizeof(T)>{};
+    bytes[member_offsets<T>[I]] = 1;
+
+    auto x = std::bit_cast<T>(bytes);
+    auto& leaf = leading_leaf_of(std::get<I>(reflector_of<T>::tie(x)));
+
+    using leaf_type = std::remove_cvref_t<decltype(leaf)>;
+    if constexpr(std::is_empty_v<leaf_type>) {
+        return true;
+    } else {
+        return std::bit_cast<std::array<unsigned char, sizeof(leaf_type)>>(
+                   leaf)[0] == 1;
+    }
+}
+
+// A concept which holds if the computed offsets of all non-static data members
+// of the given type can be checked in constant expressions, and match the
+// actual ones. This is not the case, for example, for types with pointers,
+// since they can not be constructed from bytes in constant expressions.
+template <typename T, std::size_t... Indices>
+concept has_verified_offsets = requires {
+    typename std::bool_constant<(is_member_offset_verified<T, Indices>() &&
+                                 ...)>;
+} && (is_member_offset_verified<T, Indices>() && ...);
+
+// A predicate which shows if the computed offsets of non-static data members
+// describe the actual layout of the given type. Offsets are verified with the
+// actual ones, hence the predicate does not hold for types with over-aligned
+// members, or with bit-fields. It also does not hold for types whose offsets
+// can not be verified: the types which are not trivially copyable, or which
+// have members which can not be constructed from bytes in constant
+// expressions.
+//
+// clang-format off
+template <typename T>
+constexpr auto
+has_sequential_layout =
+    []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+        if constexpr(sizeof...(Indices) == 0) {
+            return std::is_empty_v<T>;
+        } else if constexpr(!std::is_trivially_copyable_v<T> ||
+                            has_bit_fields_of<T>) {
+            return false;
+        } else if constexpr(!(has_leading_leaf<std::remove_cv_t<
+                                  member_type_t<T, Indices>>> && ...)) {
+            return false;
+        } else {
+            constexpr auto n = sizeof...(Indices) - 1;
+            constexpr auto size = member_offsets<T>[n] +
+                                  sizeof(member_type_t<T, n>);
+
+            if constexpr(align_up(size, alignof(T)) != sizeof(T)) {
+                return false;
+            } else {
+                return has_verified_offsets<T, Indices...>;
+            }
+        }
+    }(std::make_index_sequence<data_member_count<T>>{});
+// clang-format on
+
+// Computes the total number of padding bytes in the given type, including
+// padding bytes of its reflexible members, and of elements of its arrays.
+template <typename T>
+constexpr auto
+count_padding_bytes() noexcept -> std::size_t {
+    if constexpr(std::is_array_v<T>) {
+        using element_type = std::remove_cv_t<std::remove_all_extents_t<T>>;
+        return (sizeof(T) / sizeof(element_type)) *
+               count_padding_bytes<element_type>();
+    } else if constexpr(!reflexible<T>) {
+        return 0;
+    } else {
+        return []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+            return (sizeof(T) - ... - sizeof(member_type_t<T, Indices>)) +
+                   (std::size_t{0} + ... +
+                    count_padding_bytes<member_type_t<T, Indices>>());
+        }(std::make_index_sequence<data_member_count<T>>{});
+    }
+}
+
+// Kind of a type, which distinguishes types of non-static data members with
+// the same size and alignment, e.g. integers from floating-point numbers.
+enum class type_kind : std::uint64_t {
+    other,
+    boolean,
+    signed_integer,
+    unsigned_integer,
+    floating_point,
+    enumeration,
+    array,
+    aggregate
+};
+
+// Computes the kind of the given type.
+template <typename T>
+constexpr auto
+kind_of() noexcept -> type_kind {
+    if constexpr(std::same_as<T, bool>) {
+        return type_kind::boolean;
+    } else if constexpr(std::is_integral_v<T>) {
+        return std::is_signed_v<T> ? type_kind::signed_integer
+                                   : type_kind::unsigned_integer;
+    } else if constexpr(std::is_floating_point_v<T>) {
+        return type_kind::floating_point;
+    } else if constexpr(std::is_enum_v<T>) {
+        return type_kind::enumeration;
+    } else if constexpr(std::is_array_v<T>) {
+        return type_kind::array;
+    } else if constexpr(reflexible<T>) {
+        return type_kind::aggregate;
+    } else {
+        return type_kind::other;
+    }
+}
+
+} // namespace detail
+
+// A concept that models types whose layout can be computed at compile time.
+template <typename T>
+concept layout_computable = reflexible<T> && detail::has_sequential_layout<T>;
+
+// Description of the placement of a non-static data member within an object.
+struct member_layout {
+    // Offset of the member from the beginning of the object.
+    std::size_t offset;
+
+    // Size and alignment of the type of the member.
+    std::size_t size, alignment;
+
+    // Number of padding bytes between the member and the next member (or the
+    // end of the object, if the member is the last one).
+    std::size_t padding;
+};
+
+// Layout of the given type: descriptions of its non-static data members,
+// indexed in declaration order.
+//
+// clang-format off
+template <layout_computable T>
+constexpr auto
+layout =
+    []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+        constexpr auto n = sizeof...(Indices);
+
+        auto result = std::array<member_layout, n>{member_layout{
+            detail::member_offsets<T>[Indices],
+            sizeof(member_type_t<T, Indices>),
+            alignof(member_type_t<T, Indices>), 0}...};
+
+        for(auto i = std::size_t{0}; i != n; ++i) {
+            auto end = ((i + 1 == n) ? sizeof(T) : result[i + 1].offset);
+            result[i].padding = end - result[i].offset - result[i].size;
+        }
+
+        return result;
+    }(std::make_index_sequence<data_member_count<T>>{});
+// clang-format on
+
+// Total number of padding bytes in the given type, including padding bytes of
+// its reflexible members, and of elements of its arrays.
+template <layout_computable T>
+constexpr auto padding_bytes = detail::count_padding_bytes<T>();
+
+////////////////////////////////////////////////////////////////////////////////
+// Structural signatures.
+////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// A leaf of a structural signature: a non-static data member which is either
+// not an object of a reflexible type, or has unique object representations (so
+// it is processed as a whole), and its offset from the beginning of the
+// outermost object.
+template <std::size_t Offset, typename T>
+struct structure_leaf {
+    static constexpr auto offset = Offset;
+    using type = T;
+};
+
+// Concatenates the given type lists. The operator is defined, since functions
+// which compute structural signatures odr-use it, even though only the types
+// of their results are used.
+template <typename... Types0, typename... Types1>
+constexpr auto
+operator+(type_list<Types0...>, type_list<Types1...>) noexcept
+    -> type_list<Types0..., Types1...> {
+    return {};
+}
+
+// A predicate which shows if objects of the given type can be processed
+// through their structural signatures: the type has computable layout and
+// non-static data members, and so do all of its reflexible members (except the
+// ones which are processed as a whole). Computable layout implies that member
+// offsets are verified, hence leaves are never read from padding bytes.
+template <typename T>
+constexpr auto is_structurally_erasable = [] {
+    if constexpr(!layout_computable<T>) {
+        return false;
+    } else if constexpr(data_member_count<T> == 0) {
+        return false;
+    } else {
+        return []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+            return ((!reflexible<member_type_t<T, Indices>> ||
+                     std::has_unique_object_representations_v<
+                         member_type_t<T, Indices>> ||
+                     is_structurally_erasable<
+                         std::remove_cv_t<member_type_t<T, Indices>>>) &&
+                    ...);
+        }(std::make_index_sequence<data_member_count<T>>{});
+    }
+}();
+
+template <typename T, std::size_t Offset>
+auto
+structure_leaves_of();
+
+// Returns the list of leaves of the given non-static data member, which is
+// located at the given offset. Only the type of the result is used: the
+// function is never called.
+template <typename T, std::size_t Offset>
+auto
+member_leaves_of() {
+    if constexpr(reflexible<T> &&
+                 !std::has_unique_object_representations_v<T>) {
+        return structure_leaves_of<T, Offset>();
+    } else {
+        return type_list<structure_leaf<Offset, T>>{};
+    }
+}
+
+// Returns the list of leaves of non-static data members of the given type,
+// which is located at the given offset. Only the type of the result is used:
+// the function is never called.
+template <typename T, std::size_t Offset>
+auto
+structure_leaves_of() {
+    return []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+        return (type_list<>{} + ... +
+                member_leaves_of<std::remove_cv_t<member_type_t<T, Indices>>,
+                                 Offset + member_offsets<T>[Indices]>());
+    }(std::make_index_sequence<data_member_count<T>>{});
+}
+
+// Returns the reference to the given leaf of the object which is located at
+// the given address. The offset of the leaf is verified, since signatures only
+// exist for structurally erasable types.
+template <typename Leaf>
+auto
+leaf_at(const std::byte* p) noexcept -> const typename Leaf::type& {
+    return *std::launder(
+        reinterpret_cast<const typename Leaf::type*>(p + Leaf::offset));
+}
+
+} // namespace detail
+
+// A concept that models types which have structural signatures.
+template <typename T>
+concept structurally_erasable =
+    detail::is_structurally_erasable<std::remove_cv_t<T>>;
+
+// Structural signature of the given type: the list of its leaves, i.e. of its
+// non-static data members (and, recursively, of members of its reflexible
+// members) which are not decomposed further, with their offsets. Types
+// with equal signatures, e.g. struct vec4 { float x, y, z, w; } and struct
+// rgba { float r, g, b, a; }, share implementations of hashing and comparison,
+// which are instantiated once per signature instead of once per type.
+template <structurally_erasable T>
+using structural_signature =
+    decltype(detail::structure_leaves_of<std::remove_cv_t<T>, 0>());
+
+////////////////////////////////////////////////////////////////////////////////
+// Counting statistics.
+////////////////////////////////////////////////////////////////////////////////
+
+// Statistics are only available if the MIRROR_ENABLE_STATS macro is defined
+// before the first inclusion of the library headers. They are computed on
+// request, and do not affect the counting of members.
+#if defined(MIRROR_ENABLE_STATS)
+
+// Statistics of the search which counts non-static data members of a type.
+struct counting_stats {
+    // Number of non-static data members.
+    std::size_t member_count;
+
+    // Total number of probes, which check if the type is constructible with
+    // the given number of arguments, and the number of probes which were made
+    // by the exponential and by the binary search respectively.
+    std::size_t probe_count, gallop_probe_count, bisect_probe_count;
+
+    // The greatest number of arguments in a probe.
+    std::size_t max_probe_size;
+
+    // Flag which shows if the count is pinned with a member count hint. Hints
+    // are verified with two probes, without searching.
+    bool is_hinted;
+
+    // Flag which shows if members were counted with arguments in braces, which
+    // count each array member once. Otherwise the search was repeated with
+    // arguments without braces.
+    bool is_braced;
+
+    // Flag which shows if objects of the type can be reflected with the
+    // included headers.
+    bool is_reflectable;
+};
+
+namespace detail {
+
+// Records a probe with the given number of arguments in the given statistics.
+constexpr void
+record_probe(counting_stats& stats, std::size_t& counter,
+             std::size_t n) noexcept {
+    ++stats.probe_count;
+    ++counter;
+    if(n > stats.max_probe_size) {
+        stats.max_probe_size = n;
+    }
+}
+
+// Replays the binary search, and records its probes. This follows the bisect
+// function template, and instantiates the same probes.
+template <typename T, std::size_t L, std::size_t M, std::size_t R,
+          bool Is_braced>
+constexpr void
+trace_bisect(counting_stats& stats) noexcept {
+    if constexpr(L != R) {
+        record_probe(stats, stats.bisect_probe_count, M);
+
+        if constexpr(is_constructible<T, M, Is_braced>) {
+            trace_bisect<T, M, median<M, R>, R, Is_braced>(stats);
+        } else {
+            trace_bisect<T, L, median<L, M - 1>, M - 1, Is_braced>(stats);
+        }
+    }
+}
+
+// Replays the exponential search, and records its probes. This follows the
+// gallop function template.
+template <typename T, std::size_t N, std::size_t Limit, bool Is_braced>
+constexpr void
+trace_gallop(counting_stats& stats) noexcept {
+    constexpr auto l = std::size_t{N / 2};
+
+    if constexpr(N >= Limit) {
+        trace_bisect<T, l, median<l, Limit>, Limit, Is_braced>(stats);
+    } else {
+        record_probe(stats, stats.gallop_probe_count, N);
+
+        if constexpr(is_constructible<T, N, Is_braced>) {
+            trace_gallop<T, N * 2, Limit, Is_braced>(stats);
+        } else {
+            trace_bisect<T, l, median<l, N - 1>, N - 1, Is_braced>(stats);
+        }
+    }
+}
+
+// Computes counting statistics of the given type.
+template <typename T>
+constexpr auto
+compute_counting_stats() noexcept -> counting_stats {
+    constexpr auto n = data_member_count<T>;
+
+    auto stats = counting_stats{};
+    stats.member_count = n;
+    stats.is_reflectable = has_reflector<n>;
+
+    if constexpr(member_count_hint<T> != no_member_count_hint) {
+        stats.is_hinted = true;
+        stats.probe_count = 2;
+        stats.max_probe_size = n + 1;
+    } else {
+        // Replay the search with arguments in braces, and the probe which
+        // checks its result. This follows the count_data_members function
+        // template.
+        constexpr auto bit_size = std::size_t{sizeof(T) * CHAR_BIT};
+
+        if constexpr(!tuple_like<T>) {
+            trace_gallop<T, 1, bit_size, true>(stats);
+            record_probe(stats, stats.gallop_probe_count,
+                         search_member_count<T, true>() + 1);
+        }
+
+        if constexpr(is_brace_countable<T>()) {
+            stats.is_braced = true;
+        } else {
+            trace_gallop<T, 1, bit_size, false>(stats);
+        }
+    }
+
+    return stats;
+}
+
+} // namespace detail
+
+// Counting statistics of the given type.
+template <reflexible T>
+constexpr auto counting_stats_of =
+    detail::compute_counting_stats<std::remove_cv_t<T>>();
+
+#endif // MIRROR_ENABLE_STATS
+
+} // namespace mirror
+
+#endif // H_11C2AC75454C4974BF620FFAC33824B8
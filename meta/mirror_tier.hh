@@ -0,0 +1,25 @@
+// Copyright Nezametdinov E. Ildus 2022.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef H_(@guard@)
+#define H_(@guard@)
+
+#include "(@base@)"
+
+namespace mirror {
+
+////////////////////////////////////////////////////////////////////////////////
+// Tuple construction for types with up to (@limit@) non-static data members.
+////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+(@generate_specializations@)
+
+} // namespace detail
+
+} // namespace mirror
+
+#endif // H_(@guard@)
@@ -0,0 +1,4526 @@
+// Copyright Nezametdinov E. Ildus 2022.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef H_950285C5BED25A73B2FF4895FF2134C9
+#define H_950285C5BED25A73B2FF4895FF2134C9
+
+#include "mirror_core.hh"
+
+namespace mirror {
+
+////////////////////////////////////////////////////////////////////////////////
+// Tuple construction for types with up to 32 non-static data members.
+////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+template <>
+struct reflector<1> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00] = x;
+        auto& [y00] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+    }
+};
+
+template <>
+struct reflector<2> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01] = x;
+        auto& [y00, y01] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+    }
+};
+
+template <>
+struct reflector<3> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02] = x;
+        auto& [y00, y01, y02] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+    }
+};
+
+template <>
+struct reflector<4> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03] = x;
+        auto& [y00, y01, y02, y03] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+    }
+};
+
+template <>
+struct reflector<5> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04] = x;
+        auto& [y00, y01, y02, y03, y04] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+    }
+};
+
+template <>
+struct reflector<6> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05] = x;
+        auto& [y00, y01, y02, y03, y04, y05] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+    }
+};
+
+template <>
+struct reflector<7> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+    }
+};
+
+template <>
+struct reflector<8> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+    }
+};
+
+template <>
+struct reflector<9> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+    }
+};
+
+template <>
+struct reflector<10> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+    }
+};
+
+template <>
+struct reflector<11> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+    }
+};
+
+template <>
+struct reflector<12> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+    }
+};
+
+template <>
+struct reflector<13> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B,
+               e0C] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B,
+               e0C] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B,
+               e0C] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B,
+               e0C] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B,
+               e0C] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B,
+               x0C] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B,
+               y0C] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+    }
+};
+
+template <>
+struct reflector<14> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+    }
+};
+
+template <>
+struct reflector<15> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+    }
+};
+
+template <>
+struct reflector<16> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+    }
+};
+
+template <>
+struct reflector<17> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+    }
+};
+
+template <>
+struct reflector<18> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+    }
+};
+
+template <>
+struct reflector<19> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+    }
+};
+
+template <>
+struct reflector<20> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+    }
+};
+
+template <>
+struct reflector<21> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+    }
+};
+
+template <>
+struct reflector<22> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+    }
+};
+
+template <>
+struct reflector<23> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+    }
+};
+
+template <>
+struct reflector<24> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+    }
+};
+
+template <>
+struct reflector<25> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+    }
+};
+
+template <>
+struct reflector<26> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18,
+               e19] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18,
+               e19] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18,
+               e19] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18,
+               e19] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18,
+               e19] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18,
+               x19] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18,
+               y19] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+    }
+};
+
+template <>
+struct reflector<27> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+    }
+};
+
+template <>
+struct reflector<28> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+    }
+};
+
+template <>
+struct reflector<29> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+    }
+};
+
+template <>
+struct reflector<30> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+    }
+};
+
+template <>
+struct reflector<31> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+    }
+};
+
+template <>
+struct reflector<32> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+    }
+};
+
+} // namespace detail
+
+} // namespace mirror
+
+#endif // H_950285C5BED25A73B2FF4895FF2134C9
@@ -0,0 +1,9588 @@
+// Copyright Nezametdinov E. Ildus 2022.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef H_D3A84765FC375433B3072FE821BA0F33
+#define H_D3A84765FC375433B3072FE821BA0F33
+
+#include "mirror_32.hh"
+
+namespace mirror {
+
+////////////////////////////////////////////////////////////////////////////////
+// Tuple construction for types with up to 64 non-static data members.
+////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+template <>
+struct reflector<33> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+    }
+};
+
+template <>
+struct reflector<34> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+    }
+};
+
+template <>
+struct reflector<35> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+    }
+};
+
+template <>
+struct reflector<36> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22, e23);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22), decltype(e23)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+            &e23;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+        f(e23);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+        f(index<35>{}, e23);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22, x23] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22, y23] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+        f(x23, y23);
+    }
+};
+
+template <>
+struct reflector<37> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22, e23, e24);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22), decltype(e23),
+                         decltype(e24)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+            &e23;
+            &e24;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+        f(e23);
+        f(e24);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+        f(index<35>{}, e23);
+        f(index<36>{}, e24);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22, x23, x24] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22, y23, y24] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+        f(x23, y23);
+        f(x24, y24);
+    }
+};
+
+template <>
+struct reflector<38> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22, e23, e24, e25);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22), decltype(e23),
+                         decltype(e24), decltype(e25)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+            &e23;
+            &e24;
+            &e25;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+        f(e23);
+        f(e24);
+        f(e25);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+        f(index<35>{}, e23);
+        f(index<36>{}, e24);
+        f(index<37>{}, e25);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22, x23, x24, x25] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22, y23, y24, y25] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+        f(x23, y23);
+        f(x24, y24);
+        f(x25, y25);
+    }
+};
+
+template <>
+struct reflector<39> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25,
+               e26] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22, e23, e24, e25, e26);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25,
+               e26] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22), decltype(e23),
+                         decltype(e24), decltype(e25), decltype(e26)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25,
+               e26] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+            &e23;
+            &e24;
+            &e25;
+            &e26;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25,
+               e26] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+        f(e23);
+        f(e24);
+        f(e25);
+        f(e26);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25,
+               e26] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+        f(index<35>{}, e23);
+        f(index<36>{}, e24);
+        f(index<37>{}, e25);
+        f(index<38>{}, e26);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22, x23, x24, x25,
+               x26] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22, y23, y24, y25,
+               y26] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+        f(x23, y23);
+        f(x24, y24);
+        f(x25, y25);
+        f(x26, y26);
+    }
+};
+
+template <>
+struct reflector<40> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22, e23, e24, e25, e26, e27);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22), decltype(e23),
+                         decltype(e24), decltype(e25), decltype(e26),
+                         decltype(e27)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+            &e23;
+            &e24;
+            &e25;
+            &e26;
+            &e27;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+        f(e23);
+        f(e24);
+        f(e25);
+        f(e26);
+        f(e27);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+        f(index<35>{}, e23);
+        f(index<36>{}, e24);
+        f(index<37>{}, e25);
+        f(index<38>{}, e26);
+        f(index<39>{}, e27);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22, x23, x24, x25, x26,
+               x27] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22, y23, y24, y25, y26,
+               y27] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+        f(x23, y23);
+        f(x24, y24);
+        f(x25, y25);
+        f(x26, y26);
+        f(x27, y27);
+    }
+};
+
+template <>
+struct reflector<41> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22, e23, e24, e25, e26, e27, e28);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22), decltype(e23),
+                         decltype(e24), decltype(e25), decltype(e26),
+                         decltype(e27), decltype(e28)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+            &e23;
+            &e24;
+            &e25;
+            &e26;
+            &e27;
+            &e28;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+        f(e23);
+        f(e24);
+        f(e25);
+        f(e26);
+        f(e27);
+        f(e28);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+        f(index<35>{}, e23);
+        f(index<36>{}, e24);
+        f(index<37>{}, e25);
+        f(index<38>{}, e26);
+        f(index<39>{}, e27);
+        f(index<40>{}, e28);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22, x23, x24, x25, x26,
+               x27, x28] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22, y23, y24, y25, y26,
+               y27, y28] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+        f(x23, y23);
+        f(x24, y24);
+        f(x25, y25);
+        f(x26, y26);
+        f(x27, y27);
+        f(x28, y28);
+    }
+};
+
+template <>
+struct reflector<42> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22, e23, e24, e25, e26, e27, e28, e29);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22), decltype(e23),
+                         decltype(e24), decltype(e25), decltype(e26),
+                         decltype(e27), decltype(e28), decltype(e29)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+            &e23;
+            &e24;
+            &e25;
+            &e26;
+            &e27;
+            &e28;
+            &e29;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+        f(e23);
+        f(e24);
+        f(e25);
+        f(e26);
+        f(e27);
+        f(e28);
+        f(e29);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+        f(index<35>{}, e23);
+        f(index<36>{}, e24);
+        f(index<37>{}, e25);
+        f(index<38>{}, e26);
+        f(index<39>{}, e27);
+        f(index<40>{}, e28);
+        f(index<41>{}, e29);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22, x23, x24, x25, x26,
+               x27, x28, x29] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22, y23, y24, y25, y26,
+               y27, y28, y29] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+        f(x23, y23);
+        f(x24, y24);
+        f(x25, y25);
+        f(x26, y26);
+        f(x27, y27);
+        f(x28, y28);
+        f(x29, y29);
+    }
+};
+
+template <>
+struct reflector<43> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22, e23, e24, e25, e26, e27, e28, e29, e2A);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22), decltype(e23),
+                         decltype(e24), decltype(e25), decltype(e26),
+                         decltype(e27), decltype(e28), decltype(e29),
+                         decltype(e2A)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+            &e23;
+            &e24;
+            &e25;
+            &e26;
+            &e27;
+            &e28;
+            &e29;
+            &e2A;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+        f(e23);
+        f(e24);
+        f(e25);
+        f(e26);
+        f(e27);
+        f(e28);
+        f(e29);
+        f(e2A);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+        f(index<35>{}, e23);
+        f(index<36>{}, e24);
+        f(index<37>{}, e25);
+        f(index<38>{}, e26);
+        f(index<39>{}, e27);
+        f(index<40>{}, e28);
+        f(index<41>{}, e29);
+        f(index<42>{}, e2A);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22, x23, x24, x25, x26,
+               x27, x28, x29, x2A] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22, y23, y24, y25, y26,
+               y27, y28, y29, y2A] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+        f(x23, y23);
+        f(x24, y24);
+        f(x25, y25);
+        f(x26, y26);
+        f(x27, y27);
+        f(x28, y28);
+        f(x29, y29);
+        f(x2A, y2A);
+    }
+};
+
+template <>
+struct reflector<44> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22, e23, e24, e25, e26, e27, e28, e29, e2A, e2B);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22), decltype(e23),
+                         decltype(e24), decltype(e25), decltype(e26),
+                         decltype(e27), decltype(e28), decltype(e29),
+                         decltype(e2A), decltype(e2B)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+            &e23;
+            &e24;
+            &e25;
+            &e26;
+            &e27;
+            &e28;
+            &e29;
+            &e2A;
+            &e2B;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+        f(e23);
+        f(e24);
+        f(e25);
+        f(e26);
+        f(e27);
+        f(e28);
+        f(e29);
+        f(e2A);
+        f(e2B);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+        f(index<35>{}, e23);
+        f(index<36>{}, e24);
+        f(index<37>{}, e25);
+        f(index<38>{}, e26);
+        f(index<39>{}, e27);
+        f(index<40>{}, e28);
+        f(index<41>{}, e29);
+        f(index<42>{}, e2A);
+        f(index<43>{}, e2B);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22, x23, x24, x25, x26,
+               x27, x28, x29, x2A, x2B] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22, y23, y24, y25, y26,
+               y27, y28, y29, y2A, y2B] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+        f(x23, y23);
+        f(x24, y24);
+        f(x25, y25);
+        f(x26, y26);
+        f(x27, y27);
+        f(x28, y28);
+        f(x29, y29);
+        f(x2A, y2A);
+        f(x2B, y2B);
+    }
+};
+
+template <>
+struct reflector<45> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22, e23, e24, e25, e26, e27, e28, e29, e2A, e2B,
+                        e2C);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22), decltype(e23),
+                         decltype(e24), decltype(e25), decltype(e26),
+                         decltype(e27), decltype(e28), decltype(e29),
+                         decltype(e2A), decltype(e2B), decltype(e2C)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+            &e23;
+            &e24;
+            &e25;
+            &e26;
+            &e27;
+            &e28;
+            &e29;
+            &e2A;
+            &e2B;
+            &e2C;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+        f(e23);
+        f(e24);
+        f(e25);
+        f(e26);
+        f(e27);
+        f(e28);
+        f(e29);
+        f(e2A);
+        f(e2B);
+        f(e2C);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+        f(index<35>{}, e23);
+        f(index<36>{}, e24);
+        f(index<37>{}, e25);
+        f(index<38>{}, e26);
+        f(index<39>{}, e27);
+        f(index<40>{}, e28);
+        f(index<41>{}, e29);
+        f(index<42>{}, e2A);
+        f(index<43>{}, e2B);
+        f(index<44>{}, e2C);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22, x23, x24, x25, x26,
+               x27, x28, x29, x2A, x2B, x2C] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22, y23, y24, y25, y26,
+               y27, y28, y29, y2A, y2B, y2C] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+        f(x23, y23);
+        f(x24, y24);
+        f(x25, y25);
+        f(x26, y26);
+        f(x27, y27);
+        f(x28, y28);
+        f(x29, y29);
+        f(x2A, y2A);
+        f(x2B, y2B);
+        f(x2C, y2C);
+    }
+};
+
+template <>
+struct reflector<46> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22, e23, e24, e25, e26, e27, e28, e29, e2A, e2B,
+                        e2C, e2D);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22), decltype(e23),
+                         decltype(e24), decltype(e25), decltype(e26),
+                         decltype(e27), decltype(e28), decltype(e29),
+                         decltype(e2A), decltype(e2B), decltype(e2C),
+                         decltype(e2D)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+            &e23;
+            &e24;
+            &e25;
+            &e26;
+            &e27;
+            &e28;
+            &e29;
+            &e2A;
+            &e2B;
+            &e2C;
+            &e2D;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+        f(e23);
+        f(e24);
+        f(e25);
+        f(e26);
+        f(e27);
+        f(e28);
+        f(e29);
+        f(e2A);
+        f(e2B);
+        f(e2C);
+        f(e2D);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+        f(index<35>{}, e23);
+        f(index<36>{}, e24);
+        f(index<37>{}, e25);
+        f(index<38>{}, e26);
+        f(index<39>{}, e27);
+        f(index<40>{}, e28);
+        f(index<41>{}, e29);
+        f(index<42>{}, e2A);
+        f(index<43>{}, e2B);
+        f(index<44>{}, e2C);
+        f(index<45>{}, e2D);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22, x23, x24, x25, x26,
+               x27, x28, x29, x2A, x2B, x2C, x2D] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22, y23, y24, y25, y26,
+               y27, y28, y29, y2A, y2B, y2C, y2D] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+        f(x23, y23);
+        f(x24, y24);
+        f(x25, y25);
+        f(x26, y26);
+        f(x27, y27);
+        f(x28, y28);
+        f(x29, y29);
+        f(x2A, y2A);
+        f(x2B, y2B);
+        f(x2C, y2C);
+        f(x2D, y2D);
+    }
+};
+
+template <>
+struct reflector<47> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22, e23, e24, e25, e26, e27, e28, e29, e2A, e2B,
+                        e2C, e2D, e2E);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22), decltype(e23),
+                         decltype(e24), decltype(e25), decltype(e26),
+                         decltype(e27), decltype(e28), decltype(e29),
+                         decltype(e2A), decltype(e2B), decltype(e2C),
+                         decltype(e2D), decltype(e2E)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+            &e23;
+            &e24;
+            &e25;
+            &e26;
+            &e27;
+            &e28;
+            &e29;
+            &e2A;
+            &e2B;
+            &e2C;
+            &e2D;
+            &e2E;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+        f(e23);
+        f(e24);
+        f(e25);
+        f(e26);
+        f(e27);
+        f(e28);
+        f(e29);
+        f(e2A);
+        f(e2B);
+        f(e2C);
+        f(e2D);
+        f(e2E);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+        f(index<35>{}, e23);
+        f(index<36>{}, e24);
+        f(index<37>{}, e25);
+        f(index<38>{}, e26);
+        f(index<39>{}, e27);
+        f(index<40>{}, e28);
+        f(index<41>{}, e29);
+        f(index<42>{}, e2A);
+        f(index<43>{}, e2B);
+        f(index<44>{}, e2C);
+        f(index<45>{}, e2D);
+        f(index<46>{}, e2E);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22, x23, x24, x25, x26,
+               x27, x28, x29, x2A, x2B, x2C, x2D, x2E] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22, y23, y24, y25, y26,
+               y27, y28, y29, y2A, y2B, y2C, y2D, y2E] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+        f(x23, y23);
+        f(x24, y24);
+        f(x25, y25);
+        f(x26, y26);
+        f(x27, y27);
+        f(x28, y28);
+        f(x29, y29);
+        f(x2A, y2A);
+        f(x2B, y2B);
+        f(x2C, y2C);
+        f(x2D, y2D);
+        f(x2E, y2E);
+    }
+};
+
+template <>
+struct reflector<48> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22, e23, e24, e25, e26, e27, e28, e29, e2A, e2B,
+                        e2C, e2D, e2E, e2F);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22), decltype(e23),
+                         decltype(e24), decltype(e25), decltype(e26),
+                         decltype(e27), decltype(e28), decltype(e29),
+                         decltype(e2A), decltype(e2B), decltype(e2C),
+                         decltype(e2D), decltype(e2E), decltype(e2F)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+            &e23;
+            &e24;
+            &e25;
+            &e26;
+            &e27;
+            &e28;
+            &e29;
+            &e2A;
+            &e2B;
+            &e2C;
+            &e2D;
+            &e2E;
+            &e2F;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+        f(e23);
+        f(e24);
+        f(e25);
+        f(e26);
+        f(e27);
+        f(e28);
+        f(e29);
+        f(e2A);
+        f(e2B);
+        f(e2C);
+        f(e2D);
+        f(e2E);
+        f(e2F);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+        f(index<35>{}, e23);
+        f(index<36>{}, e24);
+        f(index<37>{}, e25);
+        f(index<38>{}, e26);
+        f(index<39>{}, e27);
+        f(index<40>{}, e28);
+        f(index<41>{}, e29);
+        f(index<42>{}, e2A);
+        f(index<43>{}, e2B);
+        f(index<44>{}, e2C);
+        f(index<45>{}, e2D);
+        f(index<46>{}, e2E);
+        f(index<47>{}, e2F);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22, x23, x24, x25, x26,
+               x27, x28, x29, x2A, x2B, x2C, x2D, x2E, x2F] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22, y23, y24, y25, y26,
+               y27, y28, y29, y2A, y2B, y2C, y2D, y2E, y2F] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+        f(x23, y23);
+        f(x24, y24);
+        f(x25, y25);
+        f(x26, y26);
+        f(x27, y27);
+        f(x28, y28);
+        f(x29, y29);
+        f(x2A, y2A);
+        f(x2B, y2B);
+        f(x2C, y2C);
+        f(x2D, y2D);
+        f(x2E, y2E);
+        f(x2F, y2F);
+    }
+};
+
+template <>
+struct reflector<49> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22, e23, e24, e25, e26, e27, e28, e29, e2A, e2B,
+                        e2C, e2D, e2E, e2F, e30);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22), decltype(e23),
+                         decltype(e24), decltype(e25), decltype(e26),
+                         decltype(e27), decltype(e28), decltype(e29),
+                         decltype(e2A), decltype(e2B), decltype(e2C),
+                         decltype(e2D), decltype(e2E), decltype(e2F),
+                         decltype(e30)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+            &e23;
+            &e24;
+            &e25;
+            &e26;
+            &e27;
+            &e28;
+            &e29;
+            &e2A;
+            &e2B;
+            &e2C;
+            &e2D;
+            &e2E;
+            &e2F;
+            &e30;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+        f(e23);
+        f(e24);
+        f(e25);
+        f(e26);
+        f(e27);
+        f(e28);
+        f(e29);
+        f(e2A);
+        f(e2B);
+        f(e2C);
+        f(e2D);
+        f(e2E);
+        f(e2F);
+        f(e30);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+        f(index<35>{}, e23);
+        f(index<36>{}, e24);
+        f(index<37>{}, e25);
+        f(index<38>{}, e26);
+        f(index<39>{}, e27);
+        f(index<40>{}, e28);
+        f(index<41>{}, e29);
+        f(index<42>{}, e2A);
+        f(index<43>{}, e2B);
+        f(index<44>{}, e2C);
+        f(index<45>{}, e2D);
+        f(index<46>{}, e2E);
+        f(index<47>{}, e2F);
+        f(index<48>{}, e30);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22, x23, x24, x25, x26,
+               x27, x28, x29, x2A, x2B, x2C, x2D, x2E, x2F, x30] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22, y23, y24, y25, y26,
+               y27, y28, y29, y2A, y2B, y2C, y2D, y2E, y2F, y30] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+        f(x23, y23);
+        f(x24, y24);
+        f(x25, y25);
+        f(x26, y26);
+        f(x27, y27);
+        f(x28, y28);
+        f(x29, y29);
+        f(x2A, y2A);
+        f(x2B, y2B);
+        f(x2C, y2C);
+        f(x2D, y2D);
+        f(x2E, y2E);
+        f(x2F, y2F);
+        f(x30, y30);
+    }
+};
+
+template <>
+struct reflector<50> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22, e23, e24, e25, e26, e27, e28, e29, e2A, e2B,
+                        e2C, e2D, e2E, e2F, e30, e31);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22), decltype(e23),
+                         decltype(e24), decltype(e25), decltype(e26),
+                         decltype(e27), decltype(e28), decltype(e29),
+                         decltype(e2A), decltype(e2B), decltype(e2C),
+                         decltype(e2D), decltype(e2E), decltype(e2F),
+                         decltype(e30), decltype(e31)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+            &e23;
+            &e24;
+            &e25;
+            &e26;
+            &e27;
+            &e28;
+            &e29;
+            &e2A;
+            &e2B;
+            &e2C;
+            &e2D;
+            &e2E;
+            &e2F;
+            &e30;
+            &e31;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+        f(e23);
+        f(e24);
+        f(e25);
+        f(e26);
+        f(e27);
+        f(e28);
+        f(e29);
+        f(e2A);
+        f(e2B);
+        f(e2C);
+        f(e2D);
+        f(e2E);
+        f(e2F);
+        f(e30);
+        f(e31);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+        f(index<35>{}, e23);
+        f(index<36>{}, e24);
+        f(index<37>{}, e25);
+        f(index<38>{}, e26);
+        f(index<39>{}, e27);
+        f(index<40>{}, e28);
+        f(index<41>{}, e29);
+        f(index<42>{}, e2A);
+        f(index<43>{}, e2B);
+        f(index<44>{}, e2C);
+        f(index<45>{}, e2D);
+        f(index<46>{}, e2E);
+        f(index<47>{}, e2F);
+        f(index<48>{}, e30);
+        f(index<49>{}, e31);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22, x23, x24, x25, x26,
+               x27, x28, x29, x2A, x2B, x2C, x2D, x2E, x2F, x30, x31] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22, y23, y24, y25, y26,
+               y27, y28, y29, y2A, y2B, y2C, y2D, y2E, y2F, y30, y31] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+        f(x23, y23);
+        f(x24, y24);
+        f(x25, y25);
+        f(x26, y26);
+        f(x27, y27);
+        f(x28, y28);
+        f(x29, y29);
+        f(x2A, y2A);
+        f(x2B, y2B);
+        f(x2C, y2C);
+        f(x2D, y2D);
+        f(x2E, y2E);
+        f(x2F, y2F);
+        f(x30, y30);
+        f(x31, y31);
+    }
+};
+
+template <>
+struct reflector<51> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22, e23, e24, e25, e26, e27, e28, e29, e2A, e2B,
+                        e2C, e2D, e2E, e2F, e30, e31, e32);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22), decltype(e23),
+                         decltype(e24), decltype(e25), decltype(e26),
+                         decltype(e27), decltype(e28), decltype(e29),
+                         decltype(e2A), decltype(e2B), decltype(e2C),
+                         decltype(e2D), decltype(e2E), decltype(e2F),
+                         decltype(e30), decltype(e31), decltype(e32)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+            &e23;
+            &e24;
+            &e25;
+            &e26;
+            &e27;
+            &e28;
+            &e29;
+            &e2A;
+            &e2B;
+            &e2C;
+            &e2D;
+            &e2E;
+            &e2F;
+            &e30;
+            &e31;
+            &e32;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+        f(e23);
+        f(e24);
+        f(e25);
+        f(e26);
+        f(e27);
+        f(e28);
+        f(e29);
+        f(e2A);
+        f(e2B);
+        f(e2C);
+        f(e2D);
+        f(e2E);
+        f(e2F);
+        f(e30);
+        f(e31);
+        f(e32);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+        f(index<35>{}, e23);
+        f(index<36>{}, e24);
+        f(index<37>{}, e25);
+        f(index<38>{}, e26);
+        f(index<39>{}, e27);
+        f(index<40>{}, e28);
+        f(index<41>{}, e29);
+        f(index<42>{}, e2A);
+        f(index<43>{}, e2B);
+        f(index<44>{}, e2C);
+        f(index<45>{}, e2D);
+        f(index<46>{}, e2E);
+        f(index<47>{}, e2F);
+        f(index<48>{}, e30);
+        f(index<49>{}, e31);
+        f(index<50>{}, e32);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22, x23, x24, x25, x26,
+               x27, x28, x29, x2A, x2B, x2C, x2D, x2E, x2F, x30, x31, x32] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22, y23, y24, y25, y26,
+               y27, y28, y29, y2A, y2B, y2C, y2D, y2E, y2F, y30, y31, y32] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+        f(x23, y23);
+        f(x24, y24);
+        f(x25, y25);
+        f(x26, y26);
+        f(x27, y27);
+        f(x28, y28);
+        f(x29, y29);
+        f(x2A, y2A);
+        f(x2B, y2B);
+        f(x2C, y2C);
+        f(x2D, y2D);
+        f(x2E, y2E);
+        f(x2F, y2F);
+        f(x30, y30);
+        f(x31, y31);
+        f(x32, y32);
+    }
+};
+
+template <>
+struct reflector<52> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32,
+               e33] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22, e23, e24, e25, e26, e27, e28, e29, e2A, e2B,
+                        e2C, e2D, e2E, e2F, e30, e31, e32, e33);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32,
+               e33] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22), decltype(e23),
+                         decltype(e24), decltype(e25), decltype(e26),
+                         decltype(e27), decltype(e28), decltype(e29),
+                         decltype(e2A), decltype(e2B), decltype(e2C),
+                         decltype(e2D), decltype(e2E), decltype(e2F),
+                         decltype(e30), decltype(e31), decltype(e32),
+                         decltype(e33)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32,
+               e33] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+            &e23;
+            &e24;
+            &e25;
+            &e26;
+            &e27;
+            &e28;
+            &e29;
+            &e2A;
+            &e2B;
+            &e2C;
+            &e2D;
+            &e2E;
+            &e2F;
+            &e30;
+            &e31;
+            &e32;
+            &e33;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32,
+               e33] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+        f(e23);
+        f(e24);
+        f(e25);
+        f(e26);
+        f(e27);
+        f(e28);
+        f(e29);
+        f(e2A);
+        f(e2B);
+        f(e2C);
+        f(e2D);
+        f(e2E);
+        f(e2F);
+        f(e30);
+        f(e31);
+        f(e32);
+        f(e33);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32,
+               e33] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+        f(index<35>{}, e23);
+        f(index<36>{}, e24);
+        f(index<37>{}, e25);
+        f(index<38>{}, e26);
+        f(index<39>{}, e27);
+        f(index<40>{}, e28);
+        f(index<41>{}, e29);
+        f(index<42>{}, e2A);
+        f(index<43>{}, e2B);
+        f(index<44>{}, e2C);
+        f(index<45>{}, e2D);
+        f(index<46>{}, e2E);
+        f(index<47>{}, e2F);
+        f(index<48>{}, e30);
+        f(index<49>{}, e31);
+        f(index<50>{}, e32);
+        f(index<51>{}, e33);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22, x23, x24, x25, x26,
+               x27, x28, x29, x2A, x2B, x2C, x2D, x2E, x2F, x30, x31, x32,
+               x33] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22, y23, y24, y25, y26,
+               y27, y28, y29, y2A, y2B, y2C, y2D, y2E, y2F, y30, y31, y32,
+               y33] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+        f(x23, y23);
+        f(x24, y24);
+        f(x25, y25);
+        f(x26, y26);
+        f(x27, y27);
+        f(x28, y28);
+        f(x29, y29);
+        f(x2A, y2A);
+        f(x2B, y2B);
+        f(x2C, y2C);
+        f(x2D, y2D);
+        f(x2E, y2E);
+        f(x2F, y2F);
+        f(x30, y30);
+        f(x31, y31);
+        f(x32, y32);
+        f(x33, y33);
+    }
+};
+
+template <>
+struct reflector<53> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22, e23, e24, e25, e26, e27, e28, e29, e2A, e2B,
+                        e2C, e2D, e2E, e2F, e30, e31, e32, e33, e34);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22), decltype(e23),
+                         decltype(e24), decltype(e25), decltype(e26),
+                         decltype(e27), decltype(e28), decltype(e29),
+                         decltype(e2A), decltype(e2B), decltype(e2C),
+                         decltype(e2D), decltype(e2E), decltype(e2F),
+                         decltype(e30), decltype(e31), decltype(e32),
+                         decltype(e33), decltype(e34)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+            &e23;
+            &e24;
+            &e25;
+            &e26;
+            &e27;
+            &e28;
+            &e29;
+            &e2A;
+            &e2B;
+            &e2C;
+            &e2D;
+            &e2E;
+            &e2F;
+            &e30;
+            &e31;
+            &e32;
+            &e33;
+            &e34;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+        f(e23);
+        f(e24);
+        f(e25);
+        f(e26);
+        f(e27);
+        f(e28);
+        f(e29);
+        f(e2A);
+        f(e2B);
+        f(e2C);
+        f(e2D);
+        f(e2E);
+        f(e2F);
+        f(e30);
+        f(e31);
+        f(e32);
+        f(e33);
+        f(e34);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+        f(index<35>{}, e23);
+        f(index<36>{}, e24);
+        f(index<37>{}, e25);
+        f(index<38>{}, e26);
+        f(index<39>{}, e27);
+        f(index<40>{}, e28);
+        f(index<41>{}, e29);
+        f(index<42>{}, e2A);
+        f(index<43>{}, e2B);
+        f(index<44>{}, e2C);
+        f(index<45>{}, e2D);
+        f(index<46>{}, e2E);
+        f(index<47>{}, e2F);
+        f(index<48>{}, e30);
+        f(index<49>{}, e31);
+        f(index<50>{}, e32);
+        f(index<51>{}, e33);
+        f(index<52>{}, e34);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22, x23, x24, x25, x26,
+               x27, x28, x29, x2A, x2B, x2C, x2D, x2E, x2F, x30, x31, x32, x33,
+               x34] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22, y23, y24, y25, y26,
+               y27, y28, y29, y2A, y2B, y2C, y2D, y2E, y2F, y30, y31, y32, y33,
+               y34] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+        f(x23, y23);
+        f(x24, y24);
+        f(x25, y25);
+        f(x26, y26);
+        f(x27, y27);
+        f(x28, y28);
+        f(x29, y29);
+        f(x2A, y2A);
+        f(x2B, y2B);
+        f(x2C, y2C);
+        f(x2D, y2D);
+        f(x2E, y2E);
+        f(x2F, y2F);
+        f(x30, y30);
+        f(x31, y31);
+        f(x32, y32);
+        f(x33, y33);
+        f(x34, y34);
+    }
+};
+
+template <>
+struct reflector<54> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22, e23, e24, e25, e26, e27, e28, e29, e2A, e2B,
+                        e2C, e2D, e2E, e2F, e30, e31, e32, e33, e34, e35);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22), decltype(e23),
+                         decltype(e24), decltype(e25), decltype(e26),
+                         decltype(e27), decltype(e28), decltype(e29),
+                         decltype(e2A), decltype(e2B), decltype(e2C),
+                         decltype(e2D), decltype(e2E), decltype(e2F),
+                         decltype(e30), decltype(e31), decltype(e32),
+                         decltype(e33), decltype(e34), decltype(e35)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+            &e23;
+            &e24;
+            &e25;
+            &e26;
+            &e27;
+            &e28;
+            &e29;
+            &e2A;
+            &e2B;
+            &e2C;
+            &e2D;
+            &e2E;
+            &e2F;
+            &e30;
+            &e31;
+            &e32;
+            &e33;
+            &e34;
+            &e35;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+        f(e23);
+        f(e24);
+        f(e25);
+        f(e26);
+        f(e27);
+        f(e28);
+        f(e29);
+        f(e2A);
+        f(e2B);
+        f(e2C);
+        f(e2D);
+        f(e2E);
+        f(e2F);
+        f(e30);
+        f(e31);
+        f(e32);
+        f(e33);
+        f(e34);
+        f(e35);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+        f(index<35>{}, e23);
+        f(index<36>{}, e24);
+        f(index<37>{}, e25);
+        f(index<38>{}, e26);
+        f(index<39>{}, e27);
+        f(index<40>{}, e28);
+        f(index<41>{}, e29);
+        f(index<42>{}, e2A);
+        f(index<43>{}, e2B);
+        f(index<44>{}, e2C);
+        f(index<45>{}, e2D);
+        f(index<46>{}, e2E);
+        f(index<47>{}, e2F);
+        f(index<48>{}, e30);
+        f(index<49>{}, e31);
+        f(index<50>{}, e32);
+        f(index<51>{}, e33);
+        f(index<52>{}, e34);
+        f(index<53>{}, e35);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22, x23, x24, x25, x26,
+               x27, x28, x29, x2A, x2B, x2C, x2D, x2E, x2F, x30, x31, x32, x33,
+               x34, x35] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22, y23, y24, y25, y26,
+               y27, y28, y29, y2A, y2B, y2C, y2D, y2E, y2F, y30, y31, y32, y33,
+               y34, y35] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+        f(x23, y23);
+        f(x24, y24);
+        f(x25, y25);
+        f(x26, y26);
+        f(x27, y27);
+        f(x28, y28);
+        f(x29, y29);
+        f(x2A, y2A);
+        f(x2B, y2B);
+        f(x2C, y2C);
+        f(x2D, y2D);
+        f(x2E, y2E);
+        f(x2F, y2F);
+        f(x30, y30);
+        f(x31, y31);
+        f(x32, y32);
+        f(x33, y33);
+        f(x34, y34);
+        f(x35, y35);
+    }
+};
+
+template <>
+struct reflector<55> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22, e23, e24, e25, e26, e27, e28, e29, e2A, e2B,
+                        e2C, e2D, e2E, e2F, e30, e31, e32, e33, e34, e35, e36);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22), decltype(e23),
+                         decltype(e24), decltype(e25), decltype(e26),
+                         decltype(e27), decltype(e28), decltype(e29),
+                         decltype(e2A), decltype(e2B), decltype(e2C),
+                         decltype(e2D), decltype(e2E), decltype(e2F),
+                         decltype(e30), decltype(e31), decltype(e32),
+                         decltype(e33), decltype(e34), decltype(e35),
+                         decltype(e36)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+            &e23;
+            &e24;
+            &e25;
+            &e26;
+            &e27;
+            &e28;
+            &e29;
+            &e2A;
+            &e2B;
+            &e2C;
+            &e2D;
+            &e2E;
+            &e2F;
+            &e30;
+            &e31;
+            &e32;
+            &e33;
+            &e34;
+            &e35;
+            &e36;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+        f(e23);
+        f(e24);
+        f(e25);
+        f(e26);
+        f(e27);
+        f(e28);
+        f(e29);
+        f(e2A);
+        f(e2B);
+        f(e2C);
+        f(e2D);
+        f(e2E);
+        f(e2F);
+        f(e30);
+        f(e31);
+        f(e32);
+        f(e33);
+        f(e34);
+        f(e35);
+        f(e36);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+        f(index<35>{}, e23);
+        f(index<36>{}, e24);
+        f(index<37>{}, e25);
+        f(index<38>{}, e26);
+        f(index<39>{}, e27);
+        f(index<40>{}, e28);
+        f(index<41>{}, e29);
+        f(index<42>{}, e2A);
+        f(index<43>{}, e2B);
+        f(index<44>{}, e2C);
+        f(index<45>{}, e2D);
+        f(index<46>{}, e2E);
+        f(index<47>{}, e2F);
+        f(index<48>{}, e30);
+        f(index<49>{}, e31);
+        f(index<50>{}, e32);
+        f(index<51>{}, e33);
+        f(index<52>{}, e34);
+        f(index<53>{}, e35);
+        f(index<54>{}, e36);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22, x23, x24, x25, x26,
+               x27, x28, x29, x2A, x2B, x2C, x2D, x2E, x2F, x30, x31, x32, x33,
+               x34, x35, x36] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22, y23, y24, y25, y26,
+               y27, y28, y29, y2A, y2B, y2C, y2D, y2E, y2F, y30, y31, y32, y33,
+               y34, y35, y36] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+        f(x23, y23);
+        f(x24, y24);
+        f(x25, y25);
+        f(x26, y26);
+        f(x27, y27);
+        f(x28, y28);
+        f(x29, y29);
+        f(x2A, y2A);
+        f(x2B, y2B);
+        f(x2C, y2C);
+        f(x2D, y2D);
+        f(x2E, y2E);
+        f(x2F, y2F);
+        f(x30, y30);
+        f(x31, y31);
+        f(x32, y32);
+        f(x33, y33);
+        f(x34, y34);
+        f(x35, y35);
+        f(x36, y36);
+    }
+};
+
+template <>
+struct reflector<56> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22, e23, e24, e25, e26, e27, e28, e29, e2A, e2B,
+                        e2C, e2D, e2E, e2F, e30, e31, e32, e33, e34, e35, e36,
+                        e37);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22), decltype(e23),
+                         decltype(e24), decltype(e25), decltype(e26),
+                         decltype(e27), decltype(e28), decltype(e29),
+                         decltype(e2A), decltype(e2B), decltype(e2C),
+                         decltype(e2D), decltype(e2E), decltype(e2F),
+                         decltype(e30), decltype(e31), decltype(e32),
+                         decltype(e33), decltype(e34), decltype(e35),
+                         decltype(e36), decltype(e37)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+            &e23;
+            &e24;
+            &e25;
+            &e26;
+            &e27;
+            &e28;
+            &e29;
+            &e2A;
+            &e2B;
+            &e2C;
+            &e2D;
+            &e2E;
+            &e2F;
+            &e30;
+            &e31;
+            &e32;
+            &e33;
+            &e34;
+            &e35;
+            &e36;
+            &e37;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+        f(e23);
+        f(e24);
+        f(e25);
+        f(e26);
+        f(e27);
+        f(e28);
+        f(e29);
+        f(e2A);
+        f(e2B);
+        f(e2C);
+        f(e2D);
+        f(e2E);
+        f(e2F);
+        f(e30);
+        f(e31);
+        f(e32);
+        f(e33);
+        f(e34);
+        f(e35);
+        f(e36);
+        f(e37);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+        f(index<35>{}, e23);
+        f(index<36>{}, e24);
+        f(index<37>{}, e25);
+        f(index<38>{}, e26);
+        f(index<39>{}, e27);
+        f(index<40>{}, e28);
+        f(index<41>{}, e29);
+        f(index<42>{}, e2A);
+        f(index<43>{}, e2B);
+        f(index<44>{}, e2C);
+        f(index<45>{}, e2D);
+        f(index<46>{}, e2E);
+        f(index<47>{}, e2F);
+        f(index<48>{}, e30);
+        f(index<49>{}, e31);
+        f(index<50>{}, e32);
+        f(index<51>{}, e33);
+        f(index<52>{}, e34);
+        f(index<53>{}, e35);
+        f(index<54>{}, e36);
+        f(index<55>{}, e37);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22, x23, x24, x25, x26,
+               x27, x28, x29, x2A, x2B, x2C, x2D, x2E, x2F, x30, x31, x32, x33,
+               x34, x35, x36, x37] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22, y23, y24, y25, y26,
+               y27, y28, y29, y2A, y2B, y2C, y2D, y2E, y2F, y30, y31, y32, y33,
+               y34, y35, y36, y37] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+        f(x23, y23);
+        f(x24, y24);
+        f(x25, y25);
+        f(x26, y26);
+        f(x27, y27);
+        f(x28, y28);
+        f(x29, y29);
+        f(x2A, y2A);
+        f(x2B, y2B);
+        f(x2C, y2C);
+        f(x2D, y2D);
+        f(x2E, y2E);
+        f(x2F, y2F);
+        f(x30, y30);
+        f(x31, y31);
+        f(x32, y32);
+        f(x33, y33);
+        f(x34, y34);
+        f(x35, y35);
+        f(x36, y36);
+        f(x37, y37);
+    }
+};
+
+template <>
+struct reflector<57> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22, e23, e24, e25, e26, e27, e28, e29, e2A, e2B,
+                        e2C, e2D, e2E, e2F, e30, e31, e32, e33, e34, e35, e36,
+                        e37, e38);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22), decltype(e23),
+                         decltype(e24), decltype(e25), decltype(e26),
+                         decltype(e27), decltype(e28), decltype(e29),
+                         decltype(e2A), decltype(e2B), decltype(e2C),
+                         decltype(e2D), decltype(e2E), decltype(e2F),
+                         decltype(e30), decltype(e31), decltype(e32),
+                         decltype(e33), decltype(e34), decltype(e35),
+                         decltype(e36), decltype(e37), decltype(e38)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+            &e23;
+            &e24;
+            &e25;
+            &e26;
+            &e27;
+            &e28;
+            &e29;
+            &e2A;
+            &e2B;
+            &e2C;
+            &e2D;
+            &e2E;
+            &e2F;
+            &e30;
+            &e31;
+            &e32;
+            &e33;
+            &e34;
+            &e35;
+            &e36;
+            &e37;
+            &e38;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+        f(e23);
+        f(e24);
+        f(e25);
+        f(e26);
+        f(e27);
+        f(e28);
+        f(e29);
+        f(e2A);
+        f(e2B);
+        f(e2C);
+        f(e2D);
+        f(e2E);
+        f(e2F);
+        f(e30);
+        f(e31);
+        f(e32);
+        f(e33);
+        f(e34);
+        f(e35);
+        f(e36);
+        f(e37);
+        f(e38);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+        f(index<35>{}, e23);
+        f(index<36>{}, e24);
+        f(index<37>{}, e25);
+        f(index<38>{}, e26);
+        f(index<39>{}, e27);
+        f(index<40>{}, e28);
+        f(index<41>{}, e29);
+        f(index<42>{}, e2A);
+        f(index<43>{}, e2B);
+        f(index<44>{}, e2C);
+        f(index<45>{}, e2D);
+        f(index<46>{}, e2E);
+        f(index<47>{}, e2F);
+        f(index<48>{}, e30);
+        f(index<49>{}, e31);
+        f(index<50>{}, e32);
+        f(index<51>{}, e33);
+        f(index<52>{}, e34);
+        f(index<53>{}, e35);
+        f(index<54>{}, e36);
+        f(index<55>{}, e37);
+        f(index<56>{}, e38);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22, x23, x24, x25, x26,
+               x27, x28, x29, x2A, x2B, x2C, x2D, x2E, x2F, x30, x31, x32, x33,
+               x34, x35, x36, x37, x38] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22, y23, y24, y25, y26,
+               y27, y28, y29, y2A, y2B, y2C, y2D, y2E, y2F, y30, y31, y32, y33,
+               y34, y35, y36, y37, y38] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+        f(x23, y23);
+        f(x24, y24);
+        f(x25, y25);
+        f(x26, y26);
+        f(x27, y27);
+        f(x28, y28);
+        f(x29, y29);
+        f(x2A, y2A);
+        f(x2B, y2B);
+        f(x2C, y2C);
+        f(x2D, y2D);
+        f(x2E, y2E);
+        f(x2F, y2F);
+        f(x30, y30);
+        f(x31, y31);
+        f(x32, y32);
+        f(x33, y33);
+        f(x34, y34);
+        f(x35, y35);
+        f(x36, y36);
+        f(x37, y37);
+        f(x38, y38);
+    }
+};
+
+template <>
+struct reflector<58> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22, e23, e24, e25, e26, e27, e28, e29, e2A, e2B,
+                        e2C, e2D, e2E, e2F, e30, e31, e32, e33, e34, e35, e36,
+                        e37, e38, e39);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22), decltype(e23),
+                         decltype(e24), decltype(e25), decltype(e26),
+                         decltype(e27), decltype(e28), decltype(e29),
+                         decltype(e2A), decltype(e2B), decltype(e2C),
+                         decltype(e2D), decltype(e2E), decltype(e2F),
+                         decltype(e30), decltype(e31), decltype(e32),
+                         decltype(e33), decltype(e34), decltype(e35),
+                         decltype(e36), decltype(e37), decltype(e38),
+                         decltype(e39)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+            &e23;
+            &e24;
+            &e25;
+            &e26;
+            &e27;
+            &e28;
+            &e29;
+            &e2A;
+            &e2B;
+            &e2C;
+            &e2D;
+            &e2E;
+            &e2F;
+            &e30;
+            &e31;
+            &e32;
+            &e33;
+            &e34;
+            &e35;
+            &e36;
+            &e37;
+            &e38;
+            &e39;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+        f(e23);
+        f(e24);
+        f(e25);
+        f(e26);
+        f(e27);
+        f(e28);
+        f(e29);
+        f(e2A);
+        f(e2B);
+        f(e2C);
+        f(e2D);
+        f(e2E);
+        f(e2F);
+        f(e30);
+        f(e31);
+        f(e32);
+        f(e33);
+        f(e34);
+        f(e35);
+        f(e36);
+        f(e37);
+        f(e38);
+        f(e39);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+        f(index<35>{}, e23);
+        f(index<36>{}, e24);
+        f(index<37>{}, e25);
+        f(index<38>{}, e26);
+        f(index<39>{}, e27);
+        f(index<40>{}, e28);
+        f(index<41>{}, e29);
+        f(index<42>{}, e2A);
+        f(index<43>{}, e2B);
+        f(index<44>{}, e2C);
+        f(index<45>{}, e2D);
+        f(index<46>{}, e2E);
+        f(index<47>{}, e2F);
+        f(index<48>{}, e30);
+        f(index<49>{}, e31);
+        f(index<50>{}, e32);
+        f(index<51>{}, e33);
+        f(index<52>{}, e34);
+        f(index<53>{}, e35);
+        f(index<54>{}, e36);
+        f(index<55>{}, e37);
+        f(index<56>{}, e38);
+        f(index<57>{}, e39);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22, x23, x24, x25, x26,
+               x27, x28, x29, x2A, x2B, x2C, x2D, x2E, x2F, x30, x31, x32, x33,
+               x34, x35, x36, x37, x38, x39] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22, y23, y24, y25, y26,
+               y27, y28, y29, y2A, y2B, y2C, y2D, y2E, y2F, y30, y31, y32, y33,
+               y34, y35, y36, y37, y38, y39] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+        f(x23, y23);
+        f(x24, y24);
+        f(x25, y25);
+        f(x26, y26);
+        f(x27, y27);
+        f(x28, y28);
+        f(x29, y29);
+        f(x2A, y2A);
+        f(x2B, y2B);
+        f(x2C, y2C);
+        f(x2D, y2D);
+        f(x2E, y2E);
+        f(x2F, y2F);
+        f(x30, y30);
+        f(x31, y31);
+        f(x32, y32);
+        f(x33, y33);
+        f(x34, y34);
+        f(x35, y35);
+        f(x36, y36);
+        f(x37, y37);
+        f(x38, y38);
+        f(x39, y39);
+    }
+};
+
+template <>
+struct reflector<59> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22, e23, e24, e25, e26, e27, e28, e29, e2A, e2B,
+                        e2C, e2D, e2E, e2F, e30, e31, e32, e33, e34, e35, e36,
+                        e37, e38, e39, e3A);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22), decltype(e23),
+                         decltype(e24), decltype(e25), decltype(e26),
+                         decltype(e27), decltype(e28), decltype(e29),
+                         decltype(e2A), decltype(e2B), decltype(e2C),
+                         decltype(e2D), decltype(e2E), decltype(e2F),
+                         decltype(e30), decltype(e31), decltype(e32),
+                         decltype(e33), decltype(e34), decltype(e35),
+                         decltype(e36), decltype(e37), decltype(e38),
+                         decltype(e39), decltype(e3A)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+            &e23;
+            &e24;
+            &e25;
+            &e26;
+            &e27;
+            &e28;
+            &e29;
+            &e2A;
+            &e2B;
+            &e2C;
+            &e2D;
+            &e2E;
+            &e2F;
+            &e30;
+            &e31;
+            &e32;
+            &e33;
+            &e34;
+            &e35;
+            &e36;
+            &e37;
+            &e38;
+            &e39;
+            &e3A;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+        f(e23);
+        f(e24);
+        f(e25);
+        f(e26);
+        f(e27);
+        f(e28);
+        f(e29);
+        f(e2A);
+        f(e2B);
+        f(e2C);
+        f(e2D);
+        f(e2E);
+        f(e2F);
+        f(e30);
+        f(e31);
+        f(e32);
+        f(e33);
+        f(e34);
+        f(e35);
+        f(e36);
+        f(e37);
+        f(e38);
+        f(e39);
+        f(e3A);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+        f(index<35>{}, e23);
+        f(index<36>{}, e24);
+        f(index<37>{}, e25);
+        f(index<38>{}, e26);
+        f(index<39>{}, e27);
+        f(index<40>{}, e28);
+        f(index<41>{}, e29);
+        f(index<42>{}, e2A);
+        f(index<43>{}, e2B);
+        f(index<44>{}, e2C);
+        f(index<45>{}, e2D);
+        f(index<46>{}, e2E);
+        f(index<47>{}, e2F);
+        f(index<48>{}, e30);
+        f(index<49>{}, e31);
+        f(index<50>{}, e32);
+        f(index<51>{}, e33);
+        f(index<52>{}, e34);
+        f(index<53>{}, e35);
+        f(index<54>{}, e36);
+        f(index<55>{}, e37);
+        f(index<56>{}, e38);
+        f(index<57>{}, e39);
+        f(index<58>{}, e3A);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22, x23, x24, x25, x26,
+               x27, x28, x29, x2A, x2B, x2C, x2D, x2E, x2F, x30, x31, x32, x33,
+               x34, x35, x36, x37, x38, x39, x3A] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22, y23, y24, y25, y26,
+               y27, y28, y29, y2A, y2B, y2C, y2D, y2E, y2F, y30, y31, y32, y33,
+               y34, y35, y36, y37, y38, y39, y3A] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+        f(x23, y23);
+        f(x24, y24);
+        f(x25, y25);
+        f(x26, y26);
+        f(x27, y27);
+        f(x28, y28);
+        f(x29, y29);
+        f(x2A, y2A);
+        f(x2B, y2B);
+        f(x2C, y2C);
+        f(x2D, y2D);
+        f(x2E, y2E);
+        f(x2F, y2F);
+        f(x30, y30);
+        f(x31, y31);
+        f(x32, y32);
+        f(x33, y33);
+        f(x34, y34);
+        f(x35, y35);
+        f(x36, y36);
+        f(x37, y37);
+        f(x38, y38);
+        f(x39, y39);
+        f(x3A, y3A);
+    }
+};
+
+template <>
+struct reflector<60> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A, e3B] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22, e23, e24, e25, e26, e27, e28, e29, e2A, e2B,
+                        e2C, e2D, e2E, e2F, e30, e31, e32, e33, e34, e35, e36,
+                        e37, e38, e39, e3A, e3B);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A, e3B] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22), decltype(e23),
+                         decltype(e24), decltype(e25), decltype(e26),
+                         decltype(e27), decltype(e28), decltype(e29),
+                         decltype(e2A), decltype(e2B), decltype(e2C),
+                         decltype(e2D), decltype(e2E), decltype(e2F),
+                         decltype(e30), decltype(e31), decltype(e32),
+                         decltype(e33), decltype(e34), decltype(e35),
+                         decltype(e36), decltype(e37), decltype(e38),
+                         decltype(e39), decltype(e3A), decltype(e3B)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A, e3B] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+            &e23;
+            &e24;
+            &e25;
+            &e26;
+            &e27;
+            &e28;
+            &e29;
+            &e2A;
+            &e2B;
+            &e2C;
+            &e2D;
+            &e2E;
+            &e2F;
+            &e30;
+            &e31;
+            &e32;
+            &e33;
+            &e34;
+            &e35;
+            &e36;
+            &e37;
+            &e38;
+            &e39;
+            &e3A;
+            &e3B;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A, e3B] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+        f(e23);
+        f(e24);
+        f(e25);
+        f(e26);
+        f(e27);
+        f(e28);
+        f(e29);
+        f(e2A);
+        f(e2B);
+        f(e2C);
+        f(e2D);
+        f(e2E);
+        f(e2F);
+        f(e30);
+        f(e31);
+        f(e32);
+        f(e33);
+        f(e34);
+        f(e35);
+        f(e36);
+        f(e37);
+        f(e38);
+        f(e39);
+        f(e3A);
+        f(e3B);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A, e3B] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+        f(index<35>{}, e23);
+        f(index<36>{}, e24);
+        f(index<37>{}, e25);
+        f(index<38>{}, e26);
+        f(index<39>{}, e27);
+        f(index<40>{}, e28);
+        f(index<41>{}, e29);
+        f(index<42>{}, e2A);
+        f(index<43>{}, e2B);
+        f(index<44>{}, e2C);
+        f(index<45>{}, e2D);
+        f(index<46>{}, e2E);
+        f(index<47>{}, e2F);
+        f(index<48>{}, e30);
+        f(index<49>{}, e31);
+        f(index<50>{}, e32);
+        f(index<51>{}, e33);
+        f(index<52>{}, e34);
+        f(index<53>{}, e35);
+        f(index<54>{}, e36);
+        f(index<55>{}, e37);
+        f(index<56>{}, e38);
+        f(index<57>{}, e39);
+        f(index<58>{}, e3A);
+        f(index<59>{}, e3B);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22, x23, x24, x25, x26,
+               x27, x28, x29, x2A, x2B, x2C, x2D, x2E, x2F, x30, x31, x32, x33,
+               x34, x35, x36, x37, x38, x39, x3A, x3B] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22, y23, y24, y25, y26,
+               y27, y28, y29, y2A, y2B, y2C, y2D, y2E, y2F, y30, y31, y32, y33,
+               y34, y35, y36, y37, y38, y39, y3A, y3B] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+        f(x23, y23);
+        f(x24, y24);
+        f(x25, y25);
+        f(x26, y26);
+        f(x27, y27);
+        f(x28, y28);
+        f(x29, y29);
+        f(x2A, y2A);
+        f(x2B, y2B);
+        f(x2C, y2C);
+        f(x2D, y2D);
+        f(x2E, y2E);
+        f(x2F, y2F);
+        f(x30, y30);
+        f(x31, y31);
+        f(x32, y32);
+        f(x33, y33);
+        f(x34, y34);
+        f(x35, y35);
+        f(x36, y36);
+        f(x37, y37);
+        f(x38, y38);
+        f(x39, y39);
+        f(x3A, y3A);
+        f(x3B, y3B);
+    }
+};
+
+template <>
+struct reflector<61> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A, e3B, e3C] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22, e23, e24, e25, e26, e27, e28, e29, e2A, e2B,
+                        e2C, e2D, e2E, e2F, e30, e31, e32, e33, e34, e35, e36,
+                        e37, e38, e39, e3A, e3B, e3C);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A, e3B, e3C] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22), decltype(e23),
+                         decltype(e24), decltype(e25), decltype(e26),
+                         decltype(e27), decltype(e28), decltype(e29),
+                         decltype(e2A), decltype(e2B), decltype(e2C),
+                         decltype(e2D), decltype(e2E), decltype(e2F),
+                         decltype(e30), decltype(e31), decltype(e32),
+                         decltype(e33), decltype(e34), decltype(e35),
+                         decltype(e36), decltype(e37), decltype(e38),
+                         decltype(e39), decltype(e3A), decltype(e3B),
+                         decltype(e3C)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A, e3B, e3C] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+            &e23;
+            &e24;
+            &e25;
+            &e26;
+            &e27;
+            &e28;
+            &e29;
+            &e2A;
+            &e2B;
+            &e2C;
+            &e2D;
+            &e2E;
+            &e2F;
+            &e30;
+            &e31;
+            &e32;
+            &e33;
+            &e34;
+            &e35;
+            &e36;
+            &e37;
+            &e38;
+            &e39;
+            &e3A;
+            &e3B;
+            &e3C;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A, e3B, e3C] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+        f(e23);
+        f(e24);
+        f(e25);
+        f(e26);
+        f(e27);
+        f(e28);
+        f(e29);
+        f(e2A);
+        f(e2B);
+        f(e2C);
+        f(e2D);
+        f(e2E);
+        f(e2F);
+        f(e30);
+        f(e31);
+        f(e32);
+        f(e33);
+        f(e34);
+        f(e35);
+        f(e36);
+        f(e37);
+        f(e38);
+        f(e39);
+        f(e3A);
+        f(e3B);
+        f(e3C);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A, e3B, e3C] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+        f(index<35>{}, e23);
+        f(index<36>{}, e24);
+        f(index<37>{}, e25);
+        f(index<38>{}, e26);
+        f(index<39>{}, e27);
+        f(index<40>{}, e28);
+        f(index<41>{}, e29);
+        f(index<42>{}, e2A);
+        f(index<43>{}, e2B);
+        f(index<44>{}, e2C);
+        f(index<45>{}, e2D);
+        f(index<46>{}, e2E);
+        f(index<47>{}, e2F);
+        f(index<48>{}, e30);
+        f(index<49>{}, e31);
+        f(index<50>{}, e32);
+        f(index<51>{}, e33);
+        f(index<52>{}, e34);
+        f(index<53>{}, e35);
+        f(index<54>{}, e36);
+        f(index<55>{}, e37);
+        f(index<56>{}, e38);
+        f(index<57>{}, e39);
+        f(index<58>{}, e3A);
+        f(index<59>{}, e3B);
+        f(index<60>{}, e3C);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22, x23, x24, x25, x26,
+               x27, x28, x29, x2A, x2B, x2C, x2D, x2E, x2F, x30, x31, x32, x33,
+               x34, x35, x36, x37, x38, x39, x3A, x3B, x3C] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22, y23, y24, y25, y26,
+               y27, y28, y29, y2A, y2B, y2C, y2D, y2E, y2F, y30, y31, y32, y33,
+               y34, y35, y36, y37, y38, y39, y3A, y3B, y3C] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+        f(x23, y23);
+        f(x24, y24);
+        f(x25, y25);
+        f(x26, y26);
+        f(x27, y27);
+        f(x28, y28);
+        f(x29, y29);
+        f(x2A, y2A);
+        f(x2B, y2B);
+        f(x2C, y2C);
+        f(x2D, y2D);
+        f(x2E, y2E);
+        f(x2F, y2F);
+        f(x30, y30);
+        f(x31, y31);
+        f(x32, y32);
+        f(x33, y33);
+        f(x34, y34);
+        f(x35, y35);
+        f(x36, y36);
+        f(x37, y37);
+        f(x38, y38);
+        f(x39, y39);
+        f(x3A, y3A);
+        f(x3B, y3B);
+        f(x3C, y3C);
+    }
+};
+
+template <>
+struct reflector<62> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A, e3B, e3C, e3D] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22, e23, e24, e25, e26, e27, e28, e29, e2A, e2B,
+                        e2C, e2D, e2E, e2F, e30, e31, e32, e33, e34, e35, e36,
+                        e37, e38, e39, e3A, e3B, e3C, e3D);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A, e3B, e3C, e3D] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22), decltype(e23),
+                         decltype(e24), decltype(e25), decltype(e26),
+                         decltype(e27), decltype(e28), decltype(e29),
+                         decltype(e2A), decltype(e2B), decltype(e2C),
+                         decltype(e2D), decltype(e2E), decltype(e2F),
+                         decltype(e30), decltype(e31), decltype(e32),
+                         decltype(e33), decltype(e34), decltype(e35),
+                         decltype(e36), decltype(e37), decltype(e38),
+                         decltype(e39), decltype(e3A), decltype(e3B),
+                         decltype(e3C), decltype(e3D)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A, e3B, e3C, e3D] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+            &e23;
+            &e24;
+            &e25;
+            &e26;
+            &e27;
+            &e28;
+            &e29;
+            &e2A;
+            &e2B;
+            &e2C;
+            &e2D;
+            &e2E;
+            &e2F;
+            &e30;
+            &e31;
+            &e32;
+            &e33;
+            &e34;
+            &e35;
+            &e36;
+            &e37;
+            &e38;
+            &e39;
+            &e3A;
+            &e3B;
+            &e3C;
+            &e3D;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A, e3B, e3C, e3D] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+        f(e23);
+        f(e24);
+        f(e25);
+        f(e26);
+        f(e27);
+        f(e28);
+        f(e29);
+        f(e2A);
+        f(e2B);
+        f(e2C);
+        f(e2D);
+        f(e2E);
+        f(e2F);
+        f(e30);
+        f(e31);
+        f(e32);
+        f(e33);
+        f(e34);
+        f(e35);
+        f(e36);
+        f(e37);
+        f(e38);
+        f(e39);
+        f(e3A);
+        f(e3B);
+        f(e3C);
+        f(e3D);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A, e3B, e3C, e3D] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+        f(index<35>{}, e23);
+        f(index<36>{}, e24);
+        f(index<37>{}, e25);
+        f(index<38>{}, e26);
+        f(index<39>{}, e27);
+        f(index<40>{}, e28);
+        f(index<41>{}, e29);
+        f(index<42>{}, e2A);
+        f(index<43>{}, e2B);
+        f(index<44>{}, e2C);
+        f(index<45>{}, e2D);
+        f(index<46>{}, e2E);
+        f(index<47>{}, e2F);
+        f(index<48>{}, e30);
+        f(index<49>{}, e31);
+        f(index<50>{}, e32);
+        f(index<51>{}, e33);
+        f(index<52>{}, e34);
+        f(index<53>{}, e35);
+        f(index<54>{}, e36);
+        f(index<55>{}, e37);
+        f(index<56>{}, e38);
+        f(index<57>{}, e39);
+        f(index<58>{}, e3A);
+        f(index<59>{}, e3B);
+        f(index<60>{}, e3C);
+        f(index<61>{}, e3D);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22, x23, x24, x25, x26,
+               x27, x28, x29, x2A, x2B, x2C, x2D, x2E, x2F, x30, x31, x32, x33,
+               x34, x35, x36, x37, x38, x39, x3A, x3B, x3C, x3D] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22, y23, y24, y25, y26,
+               y27, y28, y29, y2A, y2B, y2C, y2D, y2E, y2F, y30, y31, y32, y33,
+               y34, y35, y36, y37, y38, y39, y3A, y3B, y3C, y3D] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+        f(x23, y23);
+        f(x24, y24);
+        f(x25, y25);
+        f(x26, y26);
+        f(x27, y27);
+        f(x28, y28);
+        f(x29, y29);
+        f(x2A, y2A);
+        f(x2B, y2B);
+        f(x2C, y2C);
+        f(x2D, y2D);
+        f(x2E, y2E);
+        f(x2F, y2F);
+        f(x30, y30);
+        f(x31, y31);
+        f(x32, y32);
+        f(x33, y33);
+        f(x34, y34);
+        f(x35, y35);
+        f(x36, y36);
+        f(x37, y37);
+        f(x38, y38);
+        f(x39, y39);
+        f(x3A, y3A);
+        f(x3B, y3B);
+        f(x3C, y3C);
+        f(x3D, y3D);
+    }
+};
+
+template <>
+struct reflector<63> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A, e3B, e3C, e3D, e3E] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22, e23, e24, e25, e26, e27, e28, e29, e2A, e2B,
+                        e2C, e2D, e2E, e2F, e30, e31, e32, e33, e34, e35, e36,
+                        e37, e38, e39, e3A, e3B, e3C, e3D, e3E);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A, e3B, e3C, e3D, e3E] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22), decltype(e23),
+                         decltype(e24), decltype(e25), decltype(e26),
+                         decltype(e27), decltype(e28), decltype(e29),
+                         decltype(e2A), decltype(e2B), decltype(e2C),
+                         decltype(e2D), decltype(e2E), decltype(e2F),
+                         decltype(e30), decltype(e31), decltype(e32),
+                         decltype(e33), decltype(e34), decltype(e35),
+                         decltype(e36), decltype(e37), decltype(e38),
+                         decltype(e39), decltype(e3A), decltype(e3B),
+                         decltype(e3C), decltype(e3D), decltype(e3E)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A, e3B, e3C, e3D, e3E] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+            &e23;
+            &e24;
+            &e25;
+            &e26;
+            &e27;
+            &e28;
+            &e29;
+            &e2A;
+            &e2B;
+            &e2C;
+            &e2D;
+            &e2E;
+            &e2F;
+            &e30;
+            &e31;
+            &e32;
+            &e33;
+            &e34;
+            &e35;
+            &e36;
+            &e37;
+            &e38;
+            &e39;
+            &e3A;
+            &e3B;
+            &e3C;
+            &e3D;
+            &e3E;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A, e3B, e3C, e3D, e3E] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+        f(e23);
+        f(e24);
+        f(e25);
+        f(e26);
+        f(e27);
+        f(e28);
+        f(e29);
+        f(e2A);
+        f(e2B);
+        f(e2C);
+        f(e2D);
+        f(e2E);
+        f(e2F);
+        f(e30);
+        f(e31);
+        f(e32);
+        f(e33);
+        f(e34);
+        f(e35);
+        f(e36);
+        f(e37);
+        f(e38);
+        f(e39);
+        f(e3A);
+        f(e3B);
+        f(e3C);
+        f(e3D);
+        f(e3E);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A, e3B, e3C, e3D, e3E] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+        f(index<35>{}, e23);
+        f(index<36>{}, e24);
+        f(index<37>{}, e25);
+        f(index<38>{}, e26);
+        f(index<39>{}, e27);
+        f(index<40>{}, e28);
+        f(index<41>{}, e29);
+        f(index<42>{}, e2A);
+        f(index<43>{}, e2B);
+        f(index<44>{}, e2C);
+        f(index<45>{}, e2D);
+        f(index<46>{}, e2E);
+        f(index<47>{}, e2F);
+        f(index<48>{}, e30);
+        f(index<49>{}, e31);
+        f(index<50>{}, e32);
+        f(index<51>{}, e33);
+        f(index<52>{}, e34);
+        f(index<53>{}, e35);
+        f(index<54>{}, e36);
+        f(index<55>{}, e37);
+        f(index<56>{}, e38);
+        f(index<57>{}, e39);
+        f(index<58>{}, e3A);
+        f(index<59>{}, e3B);
+        f(index<60>{}, e3C);
+        f(index<61>{}, e3D);
+        f(index<62>{}, e3E);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22, x23, x24, x25, x26,
+               x27, x28, x29, x2A, x2B, x2C, x2D, x2E, x2F, x30, x31, x32, x33,
+               x34, x35, x36, x37, x38, x39, x3A, x3B, x3C, x3D, x3E] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22, y23, y24, y25, y26,
+               y27, y28, y29, y2A, y2B, y2C, y2D, y2E, y2F, y30, y31, y32, y33,
+               y34, y35, y36, y37, y38, y39, y3A, y3B, y3C, y3D, y3E] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+        f(x23, y23);
+        f(x24, y24);
+        f(x25, y25);
+        f(x26, y26);
+        f(x27, y27);
+        f(x28, y28);
+        f(x29, y29);
+        f(x2A, y2A);
+        f(x2B, y2B);
+        f(x2C, y2C);
+        f(x2D, y2D);
+        f(x2E, y2E);
+        f(x2F, y2F);
+        f(x30, y30);
+        f(x31, y31);
+        f(x32, y32);
+        f(x33, y33);
+        f(x34, y34);
+        f(x35, y35);
+        f(x36, y36);
+        f(x37, y37);
+        f(x38, y38);
+        f(x39, y39);
+        f(x3A, y3A);
+        f(x3B, y3B);
+        f(x3C, y3C);
+        f(x3D, y3D);
+        f(x3E, y3E);
+    }
+};
+
+template <>
+struct reflector<64> {
+    template <typename T>
+    static constexpr auto
+    tie(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A, e3B, e3C, e3D, e3E, e3F] = x;
+
+        // Construct a tuple from these references.
+        return std::tie(e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A,
+                        e0B, e0C, e0D, e0E, e0F, e10, e11, e12, e13, e14, e15,
+                        e16, e17, e18, e19, e1A, e1B, e1C, e1D, e1E, e1F, e20,
+                        e21, e22, e23, e24, e25, e26, e27, e28, e29, e2A, e2B,
+                        e2C, e2D, e2E, e2F, e30, e31, e32, e33, e34, e35, e36,
+                        e37, e38, e39, e3A, e3B, e3C, e3D, e3E, e3F);
+    }
+
+    template <typename T>
+    static constexpr auto
+    types(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A, e3B, e3C, e3D, e3E, e3F] = x;
+
+        // Construct a list of declared types of the members.
+        return type_list<decltype(e00), decltype(e01), decltype(e02),
+                         decltype(e03), decltype(e04), decltype(e05),
+                         decltype(e06), decltype(e07), decltype(e08),
+                         decltype(e09), decltype(e0A), decltype(e0B),
+                         decltype(e0C), decltype(e0D), decltype(e0E),
+                         decltype(e0F), decltype(e10), decltype(e11),
+                         decltype(e12), decltype(e13), decltype(e14),
+                         decltype(e15), decltype(e16), decltype(e17),
+                         decltype(e18), decltype(e19), decltype(e1A),
+                         decltype(e1B), decltype(e1C), decltype(e1D),
+                         decltype(e1E), decltype(e1F), decltype(e20),
+                         decltype(e21), decltype(e22), decltype(e23),
+                         decltype(e24), decltype(e25), decltype(e26),
+                         decltype(e27), decltype(e28), decltype(e29),
+                         decltype(e2A), decltype(e2B), decltype(e2C),
+                         decltype(e2D), decltype(e2E), decltype(e2F),
+                         decltype(e30), decltype(e31), decltype(e32),
+                         decltype(e33), decltype(e34), decltype(e35),
+                         decltype(e36), decltype(e37), decltype(e38),
+                         decltype(e39), decltype(e3A), decltype(e3B),
+                         decltype(e3C), decltype(e3D), decltype(e3E),
+                         decltype(e3F)>{};
+    }
+
+    template <typename T>
+    static constexpr auto
+    has_bit_fields(T& x) noexcept {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A, e3B, e3C, e3D, e3E, e3F] = x;
+
+        // Check if addresses of the members can be taken: this is not
+        // the case for bit-fields.
+        return std::bool_constant<!requires {
+            &e00;
+            &e01;
+            &e02;
+            &e03;
+            &e04;
+            &e05;
+            &e06;
+            &e07;
+            &e08;
+            &e09;
+            &e0A;
+            &e0B;
+            &e0C;
+            &e0D;
+            &e0E;
+            &e0F;
+            &e10;
+            &e11;
+            &e12;
+            &e13;
+            &e14;
+            &e15;
+            &e16;
+            &e17;
+            &e18;
+            &e19;
+            &e1A;
+            &e1B;
+            &e1C;
+            &e1D;
+            &e1E;
+            &e1F;
+            &e20;
+            &e21;
+            &e22;
+            &e23;
+            &e24;
+            &e25;
+            &e26;
+            &e27;
+            &e28;
+            &e29;
+            &e2A;
+            &e2B;
+            &e2C;
+            &e2D;
+            &e2E;
+            &e2F;
+            &e30;
+            &e31;
+            &e32;
+            &e33;
+            &e34;
+            &e35;
+            &e36;
+            &e37;
+            &e38;
+            &e39;
+            &e3A;
+            &e3B;
+            &e3C;
+            &e3D;
+            &e3E;
+            &e3F;
+        }>{};
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A, e3B, e3C, e3D, e3E, e3F] = x;
+
+        // Invoke the function with each reference.
+        f(e00);
+        f(e01);
+        f(e02);
+        f(e03);
+        f(e04);
+        f(e05);
+        f(e06);
+        f(e07);
+        f(e08);
+        f(e09);
+        f(e0A);
+        f(e0B);
+        f(e0C);
+        f(e0D);
+        f(e0E);
+        f(e0F);
+        f(e10);
+        f(e11);
+        f(e12);
+        f(e13);
+        f(e14);
+        f(e15);
+        f(e16);
+        f(e17);
+        f(e18);
+        f(e19);
+        f(e1A);
+        f(e1B);
+        f(e1C);
+        f(e1D);
+        f(e1E);
+        f(e1F);
+        f(e20);
+        f(e21);
+        f(e22);
+        f(e23);
+        f(e24);
+        f(e25);
+        f(e26);
+        f(e27);
+        f(e28);
+        f(e29);
+        f(e2A);
+        f(e2B);
+        f(e2C);
+        f(e2D);
+        f(e2E);
+        f(e2F);
+        f(e30);
+        f(e31);
+        f(e32);
+        f(e33);
+        f(e34);
+        f(e35);
+        f(e36);
+        f(e37);
+        f(e38);
+        f(e39);
+        f(e3A);
+        f(e3B);
+        f(e3C);
+        f(e3D);
+        f(e3E);
+        f(e3F);
+    }
+
+    template <typename T, typename F>
+    static constexpr void
+    visit_indexed(T& x, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [e00, e01, e02, e03, e04, e05, e06, e07, e08, e09, e0A, e0B, e0C,
+               e0D, e0E, e0F, e10, e11, e12, e13, e14, e15, e16, e17, e18, e19,
+               e1A, e1B, e1C, e1D, e1E, e1F, e20, e21, e22, e23, e24, e25, e26,
+               e27, e28, e29, e2A, e2B, e2C, e2D, e2E, e2F, e30, e31, e32, e33,
+               e34, e35, e36, e37, e38, e39, e3A, e3B, e3C, e3D, e3E, e3F] = x;
+
+        // Invoke the function with each index and reference.
+        f(index<0>{}, e00);
+        f(index<1>{}, e01);
+        f(index<2>{}, e02);
+        f(index<3>{}, e03);
+        f(index<4>{}, e04);
+        f(index<5>{}, e05);
+        f(index<6>{}, e06);
+        f(index<7>{}, e07);
+        f(index<8>{}, e08);
+        f(index<9>{}, e09);
+        f(index<10>{}, e0A);
+        f(index<11>{}, e0B);
+        f(index<12>{}, e0C);
+        f(index<13>{}, e0D);
+        f(index<14>{}, e0E);
+        f(index<15>{}, e0F);
+        f(index<16>{}, e10);
+        f(index<17>{}, e11);
+        f(index<18>{}, e12);
+        f(index<19>{}, e13);
+        f(index<20>{}, e14);
+        f(index<21>{}, e15);
+        f(index<22>{}, e16);
+        f(index<23>{}, e17);
+        f(index<24>{}, e18);
+        f(index<25>{}, e19);
+        f(index<26>{}, e1A);
+        f(index<27>{}, e1B);
+        f(index<28>{}, e1C);
+        f(index<29>{}, e1D);
+        f(index<30>{}, e1E);
+        f(index<31>{}, e1F);
+        f(index<32>{}, e20);
+        f(index<33>{}, e21);
+        f(index<34>{}, e22);
+        f(index<35>{}, e23);
+        f(index<36>{}, e24);
+        f(index<37>{}, e25);
+        f(index<38>{}, e26);
+        f(index<39>{}, e27);
+        f(index<40>{}, e28);
+        f(index<41>{}, e29);
+        f(index<42>{}, e2A);
+        f(index<43>{}, e2B);
+        f(index<44>{}, e2C);
+        f(index<45>{}, e2D);
+        f(index<46>{}, e2E);
+        f(index<47>{}, e2F);
+        f(index<48>{}, e30);
+        f(index<49>{}, e31);
+        f(index<50>{}, e32);
+        f(index<51>{}, e33);
+        f(index<52>{}, e34);
+        f(index<53>{}, e35);
+        f(index<54>{}, e36);
+        f(index<55>{}, e37);
+        f(index<56>{}, e38);
+        f(index<57>{}, e39);
+        f(index<58>{}, e3A);
+        f(index<59>{}, e3B);
+        f(index<60>{}, e3C);
+        f(index<61>{}, e3D);
+        f(index<62>{}, e3E);
+        f(index<63>{}, e3F);
+    }
+
+    template <typename T, typename U, typename F>
+    static constexpr void
+    visit(T& x, U& y, F& f) {
+        // Obtain references to member objects using structural bindings.
+        auto& [x00, x01, x02, x03, x04, x05, x06, x07, x08, x09, x0A, x0B, x0C,
+               x0D, x0E, x0F, x10, x11, x12, x13, x14, x15, x16, x17, x18, x19,
+               x1A, x1B, x1C, x1D, x1E, x1F, x20, x21, x22, x23, x24, x25, x26,
+               x27, x28, x29, x2A, x2B, x2C, x2D, x2E, x2F, x30, x31, x32, x33,
+               x34, x35, x36, x37, x38, x39, x3A, x3B, x3C, x3D, x3E, x3F] = x;
+        auto& [y00, y01, y02, y03, y04, y05, y06, y07, y08, y09, y0A, y0B, y0C,
+               y0D, y0E, y0F, y10, y11, y12, y13, y14, y15, y16, y17, y18, y19,
+               y1A, y1B, y1C, y1D, y1E, y1F, y20, y21, y22, y23, y24, y25, y26,
+               y27, y28, y29, y2A, y2B, y2C, y2D, y2E, y2F, y30, y31, y32, y33,
+               y34, y35, y36, y37, y38, y39, y3A, y3B, y3C, y3D, y3E, y3F] = y;
+
+        // Invoke the function with each pair of references.
+        f(x00, y00);
+        f(x01, y01);
+        f(x02, y02);
+        f(x03, y03);
+        f(x04, y04);
+        f(x05, y05);
+        f(x06, y06);
+        f(x07, y07);
+        f(x08, y08);
+        f(x09, y09);
+        f(x0A, y0A);
+        f(x0B, y0B);
+        f(x0C, y0C);
+        f(x0D, y0D);
+        f(x0E, y0E);
+        f(x0F, y0F);
+        f(x10, y10);
+        f(x11, y11);
+        f(x12, y12);
+        f(x13, y13);
+        f(x14, y14);
+        f(x15, y15);
+        f(x16, y16);
+        f(x17, y17);
+        f(x18, y18);
+        f(x19, y19);
+        f(x1A, y1A);
+        f(x1B, y1B);
+        f(x1C, y1C);
+        f(x1D, y1D);
+        f(x1E, y1E);
+        f(x1F, y1F);
+        f(x20, y20);
+        f(x21, y21);
+        f(x22, y22);
+        f(x23, y23);
+        f(x24, y24);
+        f(x25, y25);
+        f(x26, y26);
+        f(x27, y27);
+        f(x28, y28);
+        f(x29, y29);
+        f(x2A, y2A);
+        f(x2B, y2B);
+        f(x2C, y2C);
+        f(x2D, y2D);
+        f(x2E, y2E);
+        f(x2F, y2F);
+        f(x30, y30);
+        f(x31, y31);
+        f(x32, y32);
+        f(x33, y33);
+        f(x34, y34);
+        f(x35, y35);
+        f(x36, y36);
+        f(x37, y37);
+        f(x38, y38);
+        f(x39, y39);
+        f(x3A, y3A);
+        f(x3B, y3B);
+        f(x3C, y3C);
+        f(x3D, y3D);
+        f(x3E, y3E);
+        f(x3F, y3F);
+    }
+};
+
+} // namespace detail
+
+} // namespace mirror
+
+#endif // H_D3A84765FC375433B3072FE821BA0F33
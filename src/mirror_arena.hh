@@ -0,0 +1,171 @@
+// Copyright Nezametdinov E. Ildus 2022.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef H_B883377C788E483AB515F32C051F42DE
+#define H_B883377C788E483AB515F32C051F42DE
+
+#include "mirror_core.hh"
+
+#include <cstddef>
+
+#include <memory>
+#include <memory_resource>
+#include <optional>
+
+namespace mirror {
+
+////////////////////////////////////////////////////////////////////////////////
+// Arena traits.
+////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// A concept for allocator-aware types which use polymorphic allocators, e.g.
+// std::pmr::string and std::pmr::vector.
+template <typename T>
+concept pmr_aware = requires(const T& x) {
+    typename T::allocator_type;
+    requires std::same_as<
+        typename T::allocator_type,
+        std::pmr::polymorphic_allocator<typename T::value_type>>;
+    {
+        x.get_allocator().resource()
+        } -> std::same_as<std::pmr::memory_resource*>;
+};
+
+// A concept for sequences of objects of reflexible types which can be resized
+// and indexed, e.g. vectors of aggregates. Such sequences are copied element by
+// element, so that allocator-aware members of elements are placed in the arena.
+template <typename T>
+concept reflexible_sequence = reflexible<typename T::value_type> &&
+    requires(T& x, std::size_t n) {
+    x.resize(n);
+    x[n];
+    { x.size() } -> std::convertible_to<std::size_t>;
+};
+
+// A concept for types whose objects can be cleared without releasing storage.
+template <typename T>
+concept clearable = requires(T& x) {
+    x.clear();
+};
+
+// Copies the given source object to the given destination object, placing
+// members which use polymorphic allocators in the given memory resource.
+template <typename T>
+void
+copy_into_arena(T& dst, const T& src, std::pmr::memory_resource* resource) {
+    if constexpr(std::is_array_v<T>) {
+        for(auto i = std::size_t{0}; i != std::extent_v<T>; ++i) {
+            copy_into_arena(dst[i], src[i], resource);
+        }
+    } else if constexpr(reflexible<T>) {
+        for_each_member(dst, src, [resource](auto& x, auto& y) {
+            copy_into_arena(x, y, resource);
+        });
+    } else if constexpr(is_specialization_of<T, std::optional>) {
+        using value_type = typename T::value_type;
+
+        if(!src.has_value()) {
+            dst.reset();
+            return;
+        }
+
+        // Values are copied recursively, so that values which use polymorphic
+        // allocators, or have members which use them, are placed in the given
+        // resource.
+        if(!dst.has_value()) {
+            if constexpr(pmr_aware<value_type>) {
+                dst.emplace(typename value_type::allocator_type{resource});
+            } else if constexpr(std::default_initializable<value_type>) {
+                dst.emplace();
+            } else {
+                dst = src;
+                return;
+            }
+        }
+
+        copy_into_arena(*dst, *src, resource);
+    } else {
+        if constexpr(pmr_aware<T>) {
+            // Objects which use other resources are recreated empty in the
+            // given resource. Objects which already use it keep their storage.
+            if(dst.get_allocator().resource() != resource) {
+                std::destroy_at(std::addressof(dst));
+                std::construct_at(std::addressof(dst),
+                                  typename T::allocator_type{resource});
+            }
+        }
+
+        if constexpr(reflexible_sequence<T>) {
+            dst.resize(src.size());
+            for(auto i = std::size_t{0}; i != src.size(); ++i) {
+                copy_into_arena(dst[i], src[i], resource);
+            }
+        } else {
+            // Polymorphic allocators do not propagate on copy assignment, so
+            // elements of containers which use them are constructed with the
+            // allocator of the destination.
+            dst = src;
+        }
+    }
+}
+
+// Resets the given object, keeping the storage of its members.
+template <typename T>
+void
+reset_object(T& x) {
+    if constexpr(std::is_array_v<T>) {
+        for(auto& element : x) {
+            reset_object(element);
+        }
+    } else if constexpr(reflexible<T>) {
+        for_each_member(x, [](auto& member) { reset_object(member); });
+    } else if constexpr(is_specialization_of<T, std::optional>) {
+        x.reset();
+    } else if constexpr(clearable<T>) {
+        x.clear();
+    } else {
+        x = T{};
+    }
+}
+
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////
+// Deep copy and reset.
+////////////////////////////////////////////////////////////////////////////////
+
+// Copies the given source object to the given destination object, recursively
+// descending into non-static data members of reflexible types, into elements of
+// arrays, into values of optional objects, and into elements of resizable
+// sequences of objects of reflexible types. Members which use polymorphic
+// allocators (e.g. std::pmr::string and std::pmr::vector) are rebuilt in the
+// given memory resource, unless they already use it, in which case their
+// storage is reused. Other members are copy-assigned. The resource must outlive
+// the destination object, or the members which use it.
+template <reflexible T>
+void
+deep_copy_into(T& dst, const T& src,
+               std::pmr::memory_resource* resource =
+                   std::pmr::get_default_resource()) {
+    detail::copy_into_arena(dst, src, resource);
+}
+
+// Resets non-static data members of the given object, recursively descending
+// into members of reflexible types and into elements of arrays. Containers are
+// cleared without releasing their storage, optional objects are reset, and
+// other members are value-initialized. Together with deep_copy_into this lets
+// the same object be refilled without allocating memory, as long as its
+// containers have sufficient capacity.
+template <reflexible T>
+void
+reset(T& x) {
+    detail::reset_object(x);
+}
+
+} // namespace mirror
+
+#endif // H_B883377C788E483AB515F32C051F42DE
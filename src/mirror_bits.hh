@@ -0,0 +1,224 @@
+// Copyright Nezametdinov E. Ildus 2022.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef H_6C71B0C598DA4723B7D0F279AD224F8D
+#define H_6C71B0C598DA4723B7D0F279AD224F8D
+
+#include "mirror_core.hh"
+
+#include <cstddef>
+#include <cstdint>
+
+#include <array>
+#include <span>
+
+namespace mirror {
+
+////////////////////////////////////////////////////////////////////////////////
+// Bit widths.
+////////////////////////////////////////////////////////////////////////////////
+
+// A customization point which holds the numbers of bits which non-static data
+// members of the given type occupy when packed, in declaration order. Members
+// must be integers, enumerations or bool values. A specialization must be
+// visible wherever the type is packed, e.g.:
+//
+//     template <>
+//     constexpr auto mirror::bit_widths<quote> =
+//         std::array<std::size_t, 3>{1, 4, 20};
+//
+template <typename T>
+constexpr auto bit_widths = std::array<std::size_t, 0>{};
+
+namespace detail {
+
+// A predicate which shows if the given type can be packed into the given
+// number of bits.
+template <typename T>
+constexpr auto
+is_bit_packable_member(std::size_t width) noexcept -> bool {
+    if constexpr(std::is_enum_v<T>) {
+        return is_bit_packable_member<std::underlying_type_t<T>>(width);
+    } else if constexpr(std::is_integral_v<T>) {
+        return (width != 0) && (width <= sizeof(T) * CHAR_BIT) &&
+               (width <= 64);
+    } else {
+        return false;
+    }
+}
+
+// A predicate which shows if the bit widths of the given type are valid.
+template <typename T>
+constexpr auto has_valid_bit_widths = [] {
+    constexpr auto n = bit_widths<T>.size();
+    static_assert((n == 0) || (n == data_member_count<T>),
+                  "The number of bit widths does not match the number of "
+                  "non-static data members.");
+
+    if constexpr(n != data_member_count<T>) {
+        return false;
+    } else {
+        return []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+            return (is_bit_packable_member<member_type_t<T, Indices>>(
+                        bit_widths<T>[Indices]) &&
+                    ...);
+        }(std::make_index_sequence<data_member_count<T>>{});
+    }
+}();
+
+} // namespace detail
+
+// A concept that models types whose objects can be bit-packed: reflexible types
+// with a bit width for each non-static data member. Each width must be nonzero,
+// and must not exceed the number of bits in the type of its member.
+template <typename T>
+concept bit_packable = reflexible<T> && (data_member_count<T> != 0) &&
+                       detail::has_valid_bit_widths<T>;
+
+namespace detail {
+
+// Offsets (in bits) of packed non-static data members of the given type,
+// followed by the total number of bits.
+template <typename T>
+constexpr auto bit_offsets = [] {
+    auto offsets = std::array<std::size_t, data_member_count<T> + 1>{};
+
+    for(auto i = std::size_t{0}; i != data_member_count<T>; ++i) {
+        offsets[i + 1] = offsets[i] + bit_widths<T>[i];
+    }
+
+    return offsets;
+}();
+
+// Returns the mask of the given number of low bits.
+constexpr auto
+low_bits_mask(std::size_t width) noexcept -> std::uint64_t {
+    return (width == 64) ? ~std::uint64_t{0}
+                         : ((std::uint64_t{1} << width) - 1);
+}
+
+// Packed words of an object of the given type.
+template <typename T>
+using packed_words =
+    std::array<std::uint64_t, (bit_offsets<T>.back() + 63) / 64>;
+
+// Converts the given member to its packed representation.
+template <typename T>
+constexpr auto
+to_packed(const T& x) noexcept -> std::uint64_t {
+    if constexpr(std::is_enum_v<T>) {
+        return to_packed(static_cast<std::underlying_type_t<T>>(x));
+    } else {
+        return static_cast<std::uint64_t>(x);
+    }
+}
+
+// Converts the given packed representation with the given width to an object
+// of the given type. Signed values are sign-extended.
+template <typename T>
+constexpr auto
+from_packed(std::uint64_t v, std::size_t width) noexcept -> T {
+    if constexpr(std::is_enum_v<T>) {
+        return static_cast<T>(
+            from_packed<std::underlying_type_t<T>>(v, width));
+    } else if constexpr(std::same_as<T, bool>) {
+        return v != 0;
+    } else if constexpr(std::is_signed_v<T>) {
+        auto sign = std::uint64_t{1} << (width - 1);
+        return static_cast<T>(static_cast<std::int64_t>((v ^ sign) - sign));
+    } else {
+        return static_cast<T>(v);
+    }
+}
+
+} // namespace detail
+
+// Number of bytes which objects of the given type occupy when bit-packed.
+template <bit_packable T>
+constexpr auto packed_size = (detail::bit_offsets<T>.back() + 7) / 8;
+
+////////////////////////////////////////////////////////////////////////////////
+// Bit packing.
+////////////////////////////////////////////////////////////////////////////////
+
+// Packs non-static data members of the given object into the given buffer.
+// Members are packed in declaration order into 64-bit words, starting from the
+// least significant bit, each member occupying the number of bits given by the
+// bit_widths customization point (a member may span two words). Words are
+// written in little-endian byte order, and only the bytes which hold packed
+// bits are written. Bits of values which do not fit in the widths of their
+// members are discarded. Returns the number of written bytes, or zero if the
+// buffer is too small.
+template <bit_packable T>
+auto
+pack_bits(std::span<std::byte> out, const T& x) noexcept -> std::size_t {
+    constexpr auto& offsets = detail::bit_offsets<T>;
+    constexpr auto& widths = bit_widths<T>;
+
+    if(out.size() < packed_size<T>) {
+        return 0;
+    }
+
+    auto words = detail::packed_words<T>{};
+
+    for_each_member_indexed(x, [&](auto i, auto& m) {
+        constexpr auto I = decltype(i)::value;
+        constexpr auto shift = offsets[I] % 64;
+
+        auto v = detail::to_packed(m) & detail::low_bits_mask(widths[I]);
+        words[offsets[I] / 64] |= v << shift;
+
+        if constexpr(shift + widths[I] > 64) {
+            words[offsets[I] / 64 + 1] |= v >> (64 - shift);
+        }
+    });
+
+    for(auto i = std::size_t{0}; i != packed_size<T>; ++i) {
+        out[i] = static_cast<std::byte>(words[i / 8] >> ((i % 8) * 8));
+    }
+
+    return packed_size<T>;
+}
+
+// Unpacks non-static data members of the given object from the given buffer,
+// which holds the representation produced by the pack_bits function. Returns
+// the number of read bytes, or zero if the buffer is too small, in which case
+// the object is left unchanged.
+template <bit_packable T>
+auto
+unpack_bits(std::span<const std::byte> in, T& x) noexcept -> std::size_t {
+    constexpr auto& offsets = detail::bit_offsets<T>;
+    constexpr auto& widths = bit_widths<T>;
+
+    if(in.size() < packed_size<T>) {
+        return 0;
+    }
+
+    auto words = detail::packed_words<T>{};
+
+    for(auto i = std::size_t{0}; i != packed_size<T>; ++i) {
+        words[i / 8] |= static_cast<std::uint64_t>(in[i]) << ((i % 8) * 8);
+    }
+
+    for_each_member_indexed(x, [&](auto i, auto& m) {
+        constexpr auto I = decltype(i)::value;
+        constexpr auto shift = offsets[I] % 64;
+
+        auto v = words[offsets[I] / 64] >> shift;
+
+        if constexpr(shift + widths[I] > 64) {
+            v |= words[offsets[I] / 64 + 1] << (64 - shift);
+        }
+
+        m = detail::from_packed<std::remove_cvref_t<decltype(m)>>(
+            v & detail::low_bits_mask(widths[I]), widths[I]);
+    });
+
+    return packed_size<T>;
+}
+
+} // namespace mirror
+
+#endif // H_6C71B0C598DA4723B7D0F279AD224F8D
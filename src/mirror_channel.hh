@@ -0,0 +1,409 @@
+// Copyright Nezametdinov E. Ildus 2022.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef H_92584A94031247AD9CCB5257647D7A95
+#define H_92584A94031247AD9CCB5257647D7A95
+
+#include "mirror_core.hh"
+#include "mirror_hash.hh"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace mirror {
+
+////////////////////////////////////////////////////////////////////////////////
+// Channel layout.
+////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// Header of a shared memory channel. The header is followed by the offsets of
+// non-static data members of messages, then by the read and write positions,
+// each on its own cache line, and then by the slots of the ring, which start at
+// the given offset from the beginning of the shared memory object.
+struct channel_header {
+    std::uint64_t magic, version, fingerprint;
+    std::uint64_t message_size, message_alignment;
+    std::uint64_t member_count, capacity;
+    std::uint64_t positions_offset, data_offset;
+};
+
+// Signature of channels ("MIRRORCH" in little-endian byte order). It is
+// written after the rest of the channel is initialized, so that peers never
+// attach to a channel which is being created.
+constexpr auto channel_magic = std::uint64_t{0x4843524F5252494D};
+
+// Version of the layout of channels.
+constexpr auto channel_version = std::uint64_t{1};
+
+// Size of the blocks of memory which are kept apart to avoid false sharing of
+// positions between the producer and the consumer.
+constexpr auto channel_line_size = std::size_t{64};
+
+// Offsets of non-static data members of messages of the given type.
+//
+// clang-format off
+template <typename T>
+constexpr auto
+channel_schema_of =
+    []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+        return std::array<std::uint64_t, sizeof...(Indices)>{
+            std::uint64_t{member_offsets<T>[Indices]}...};
+    }(std::make_index_sequence<data_member_count<T>>{});
+// clang-format on
+
+// Computes the offset of positions in channels of messages of the given type.
+template <typename T>
+constexpr auto
+channel_positions_offset() noexcept -> std::size_t {
+    return align_up(sizeof(channel_header) + sizeof(channel_schema_of<T>),
+                    channel_line_size);
+}
+
+// Computes the offset of slots in channels of messages of the given type.
+template <typename T>
+constexpr auto
+channel_data_offset() noexcept -> std::size_t {
+    return align_up(channel_positions_offset<T>() + 2 * channel_line_size,
+                    std::max(alignof(T), channel_line_size));
+}
+
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////
+// Shared memory channels.
+////////////////////////////////////////////////////////////////////////////////
+
+// A single-producer, single-consumer lock-free ring of messages of the given
+// type, which is stored in a POSIX shared memory object. The object starts with
+// a header which holds the layout fingerprint of messages, their size and
+// alignment, and offsets of their non-static data members. A peer attaches to
+// the channel only if all of these match its own type, so programs which were
+// built with different definitions of the type never exchange messages.
+// Messages are copied to and from slots of the ring as sequences of bytes,
+// without serialization. At any moment only one thread may push messages, and
+// only one thread may pop them (possibly in different processes).
+template <layout_computable T>
+class shm_channel {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Messages must be trivially copyable.");
+
+    static_assert(std::atomic_ref<std::uint64_t>::is_always_lock_free,
+                  "Positions in shared memory must be lock-free.");
+
+public:
+    // Creates a channel with the given name, which holds at least the given
+    // number of messages (the capacity is rounded up to a power of two).
+    // Returns an empty optional if the capacity is zero, or if the shared
+    // memory object can not be created, e.g. if it already exists.
+    static auto
+    create(const char* name, std::size_t capacity)
+        -> std::optional<shm_channel> {
+        if((capacity == 0) ||
+           (capacity > std::bit_floor((max_size - data_offset) / sizeof(T)))) {
+            return std::nullopt;
+        }
+
+        capacity = std::bit_ceil(capacity);
+        auto size = data_offset + capacity * sizeof(T);
+
+        auto fd = ::shm_open(name, O_RDWR | O_CREAT | O_EXCL, 0600);
+        if(fd == -1) {
+            return std::nullopt;
+        }
+
+        auto result = std::optional<shm_channel>{};
+
+        if(::ftruncate(fd, static_cast<off_t>(size)) == 0) {
+            if(auto address = map(fd, size); address != nullptr) {
+                auto header = detail::channel_header{
+                    .magic = 0,
+                    .version = detail::channel_version,
+                    .fingerprint = layout_fingerprint<T>,
+                    .message_size = sizeof(T),
+                    .message_alignment = alignof(T),
+                    .member_count = schema.size(),
+                    .capacity = capacity,
+                    .positions_offset = positions_offset,
+                    .data_offset = data_offset};
+
+                // The object is zero-filled, hence both positions are zero.
+                auto bytes = static_cast<std::byte*>(address);
+                std::memcpy(bytes, &header, sizeof(header));
+                std::memcpy(
+                    bytes + sizeof(header), schema.data(), sizeof(schema));
+
+                std::atomic_ref{*static_cast<std::uint64_t*>(address)}.store(
+                    detail::channel_magic, std::memory_order_release);
+
+                result = shm_channel{address, size, capacity};
+            }
+        }
+
+        if(!result) {
+            ::shm_unlink(name);
+        }
+
+        ::close(fd);
+        return result;
+    }
+
+    // Attaches to the channel with the given name. Returns an empty optional
+    // if the shared memory object can not be mapped, if it is not a channel,
+    // if it is not yet fully created, or if the layout of its messages does
+    // not match the type.
+    static auto
+    attach(const char* name) -> std::optional<shm_channel> {
+        auto fd = ::shm_open(name, O_RDWR, 0);
+        if(fd == -1) {
+            return std::nullopt;
+        }
+
+        struct stat status = {};
+        auto result = std::optional<shm_channel>{};
+
+        if((::fstat(fd, &status) == 0) &&
+           (static_cast<std::size_t>(status.st_size) >= data_offset)) {
+            auto size = static_cast<std::size_t>(status.st_size);
+
+            if(auto address = map(fd, size); address != nullptr) {
+                if(auto capacity = validate(address, size); capacity != 0) {
+                    result = shm_channel{address, size, capacity};
+                } else {
+                    ::munmap(address, size);
+                }
+            }
+        }
+
+        ::close(fd);
+        return result;
+    }
+
+    // Removes the name of the channel. Attached peers keep their mappings.
+    // Returns true on success.
+    static auto
+    remove(const char* name) noexcept -> bool {
+        return ::shm_unlink(name) == 0;
+    }
+
+    shm_channel(const shm_channel&) = delete;
+    shm_channel(shm_channel&& other) noexcept
+        : address_{std::exchange(other.address_, nullptr)}
+        , size_{std::exchange(other.size_, 0)}
+        , capacity_{other.capacity_}
+        , cached_read_position_{other.cached_read_position_}
+        , cached_write_position_{other.cached_write_position_} {
+    }
+
+    ~shm_channel() {
+        if(address_ != nullptr) {
+            ::munmap(address_, size_);
+        }
+    }
+
+    auto
+    operator=(const shm_channel&) -> shm_channel& = delete;
+
+    auto
+    operator=(shm_channel&& other) noexcept -> shm_channel& {
+        // The mapping of this channel is released by the destructor of the
+        // other channel.
+        std::swap(address_, other.address_);
+        std::swap(size_, other.size_);
+        capacity_ = other.capacity_;
+        cached_read_position_ = other.cached_read_position_;
+        cached_write_position_ = other.cached_write_position_;
+
+        return *this;
+    }
+
+    // Returns the number of slots in the ring.
+    auto
+    capacity() const noexcept -> std::size_t {
+        return capacity_;
+    }
+
+    // Returns the number of messages in the ring. The result is exact only if
+    // neither peer modifies the ring concurrently.
+    auto
+    size() const noexcept -> std::size_t {
+        auto w = write_position().load(std::memory_order_acquire);
+        auto r = read_position().load(std::memory_order_acquire);
+
+        return static_cast<std::size_t>(w - r);
+    }
+
+    // Copies the given message to the next slot of the ring. Returns false if
+    // the ring is full. Must only be called by the producer.
+    auto
+    try_push(const T& x) noexcept -> bool {
+        auto w = write_position().load(std::memory_order_relaxed);
+
+        // The read position is loaded from shared memory only if the ring
+        // appears to be full, so that the producer does not contend for the
+        // cache line of the consumer on each message.
+        if(w - cached_read_position_ == capacity_) {
+            cached_read_position_ =
+                read_position().load(std::memory_order_acquire);
+
+            if(w - cached_read_position_ == capacity_) {
+                return false;
+            }
+        }
+
+        std::memcpy(slot(w), std::addressof(x), sizeof(T));
+        write_position().store(w + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    // Copies the message from the oldest slot of the ring to the given object,
+    // and frees the slot. Returns false if the ring is empty, in which case
+    // the object is left unchanged. Must only be called by the consumer.
+    auto
+    try_pop(T& x) noexcept -> bool {
+        auto r = read_position().load(std::memory_order_relaxed);
+
+        if(r == cached_write_position_) {
+            cached_write_position_ =
+                write_position().load(std::memory_order_acquire);
+
+            if(r == cached_write_position_) {
+                return false;
+            }
+        }
+
+        std::memcpy(std::addressof(x), slot(r), sizeof(T));
+        read_position().store(r + 1, std::memory_order_release);
+
+        return true;
+    }
+
+private:
+    static constexpr auto& schema = detail::channel_schema_of<T>;
+    static constexpr auto positions_offset =
+        detail::channel_positions_offset<T>();
+    static constexpr auto data_offset = detail::channel_data_offset<T>();
+
+    // The greatest size of a shared memory object.
+    static constexpr auto max_size =
+        static_cast<std::size_t>(std::numeric_limits<off_t>::max());
+
+    // Positions are cached when the channel is attached, so a peer which
+    // attaches to a channel which is in use continues from its state.
+    shm_channel(void* address, std::size_t size, std::size_t capacity) noexcept
+        : address_{address}, size_{size}, capacity_{capacity} {
+        cached_read_position_ = read_position().load(std::memory_order_acquire);
+        cached_write_position_ =
+            write_position().load(std::memory_order_acquire);
+    }
+
+    // Maps the shared memory object with the given descriptor and size.
+    // Returns the address of the mapping, or nullptr on failure.
+    static auto
+    map(int fd, std::size_t size) noexcept -> void* {
+        auto address =
+            ::mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+
+        return (address != MAP_FAILED) ? address : nullptr;
+    }
+
+    // Validates the header and the schema of the channel at the given address,
+    // and checks if they match the type. Returns the capacity of the channel,
+    // or zero if it is not valid.
+    static auto
+    validate(void* address, std::size_t size) noexcept -> std::size_t {
+        // The signature is loaded first: the rest of the header is valid only
+        // if the signature is written.
+        if(std::atomic_ref{*static_cast<std::uint64_t*>(address)}.load(
+               std::memory_order_acquire) != detail::channel_magic) {
+            return 0;
+        }
+
+        auto h = detail::channel_header{};
+        auto bytes = static_cast<const std::byte*>(address);
+        std::memcpy(&h, bytes, sizeof(h));
+
+        if((h.version != detail::channel_version) ||
+           (h.fingerprint != layout_fingerprint<T>) ||
+           (h.message_size != sizeof(T)) ||
+           (h.message_alignment != alignof(T)) ||
+           (h.member_count != schema.size()) ||
+           (h.positions_offset != positions_offset) ||
+           (h.data_offset != data_offset)) {
+            return 0;
+        }
+
+        if(std::memcmp(bytes + sizeof(h), schema.data(), sizeof(schema)) != 0) {
+            return 0;
+        }
+
+        // The capacity must be a power of two, and all slots must fit in the
+        // shared memory object.
+        if(!std::has_single_bit(h.capacity) ||
+           (h.capacity > (size - data_offset) / sizeof(T))) {
+            return 0;
+        }
+
+        return static_cast<std::size_t>(h.capacity);
+    }
+
+    // Returns the position with the given offset from the beginning of the
+    // block of positions. Positions grow monotonically, and are never reset.
+    auto
+    position(std::size_t offset) const noexcept
+        -> std::atomic_ref<std::uint64_t> {
+        return std::atomic_ref{*reinterpret_cast<std::uint64_t*>(
+            static_cast<std::byte*>(address_) + positions_offset + offset)};
+    }
+
+    // Returns the position of the next message which is read.
+    auto
+    read_position() const noexcept -> std::atomic_ref<std::uint64_t> {
+        return position(0);
+    }
+
+    // Returns the position of the next message which is written.
+    auto
+    write_position() const noexcept -> std::atomic_ref<std::uint64_t> {
+        return position(detail::channel_line_size);
+    }
+
+    // Returns the pointer to the slot which holds the message with the given
+    // position.
+    auto
+    slot(std::uint64_t i) const noexcept -> std::byte* {
+        return static_cast<std::byte*>(address_) + data_offset +
+               static_cast<std::size_t>(i & (capacity_ - 1)) * sizeof(T);
+    }
+
+    void* address_{};
+    std::size_t size_{};
+    std::size_t capacity_{};
+
+    // Positions which were last loaded from shared memory by the producer and
+    // by the consumer respectively.
+    std::uint64_t cached_read_position_{};
+    std::uint64_t cached_write_position_{};
+};
+
+} // namespace mirror
+
+#endif // H_92584A94031247AD9CCB5257647D7A95
@@ -0,0 +1,188 @@
+// Copyright Nezametdinov E. Ildus 2022.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef H_F489EB9B957E413CA7F8AD77E4E14525
+#define H_F489EB9B957E413CA7F8AD77E4E14525
+
+#include "mirror_core.hh"
+
+#include <cstddef>
+#include <cstring>
+
+#include <memory>
+#include <optional>
+#include <span>
+#include <vector>
+
+namespace mirror {
+
+////////////////////////////////////////////////////////////////////////////////
+// Column traits.
+////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// Traits of columns which store values of non-static data members of the given
+// type. Members of std::optional types store their values in columns which
+// have validity bitmaps.
+template <typename T>
+struct column_traits {
+    using value_type = T;
+    static constexpr auto is_nullable = false;
+};
+
+template <typename T>
+struct column_traits<std::optional<T>> {
+    using value_type = T;
+    static constexpr auto is_nullable = true;
+};
+
+// Type of values in the column with the given index.
+template <typename T, std::size_t I>
+using column_value_type =
+    typename column_traits<member_type_t<T, I>>::value_type;
+
+// A predicate which shows if objects of the given type can be encoded as
+// columns: values of each of its non-static data members must be trivially
+// copyable.
+//
+// clang-format off
+template <typename T>
+constexpr auto
+is_columnar =
+    []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+        return (sizeof...(Indices) != 0) &&
+               (std::is_trivially_copyable_v<column_value_type<T, Indices>> &&
+                ...);
+    }(std::make_index_sequence<data_member_count<T>>{});
+// clang-format on
+
+// Computes the number of bytes in the validity bitmap of a column with the
+// given number of values.
+constexpr auto
+bitmap_size(std::size_t n) noexcept -> std::size_t {
+    return (n + CHAR_BIT - 1) / CHAR_BIT;
+}
+
+} // namespace detail
+
+// A concept that models types which can be encoded as columns.
+template <typename T>
+concept columnar = reflexible<T> && detail::is_columnar<std::remove_cv_t<T>>;
+
+// A column which holds values of one non-static data member of a sequence of
+// objects. Values are stored contiguously, in native byte order. Columns of
+// members of std::optional types also have validity bitmaps: the bit with the
+// index i (the least significant bit of the byte i / CHAR_BIT comes first) is
+// set if the value with the index i is present. Absent values are zeros.
+struct column_view {
+    std::span<const std::byte> values;
+    std::span<const std::byte> validity;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Column encoding.
+////////////////////////////////////////////////////////////////////////////////
+
+// Encodes the given objects as columns, one for each non-static data member,
+// and invokes the given sink with the index of each member (as
+// std::integral_constant) and its column. Columns are only valid until the
+// sink returns.
+template <columnar T, typename F>
+void
+encode_columns(std::span<const T> rows, F&& sink) {
+    auto values = std::vector<std::byte>{};
+    auto validity = std::vector<std::byte>{};
+
+    [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+        (
+            [&] {
+                using traits = detail::column_traits<member_type_t<T, Indices>>;
+                using value_type = typename traits::value_type;
+
+                values.assign(rows.size() * sizeof(value_type), std::byte{});
+                validity.assign(
+                    traits::is_nullable ? detail::bitmap_size(rows.size()) : 0,
+                    std::byte{});
+
+                for(auto i = std::size_t{0}; i != rows.size(); ++i) {
+                    auto& member = std::get<Indices>(reflect(rows[i]));
+                    auto destination = values.data() + i * sizeof(value_type);
+
+                    if constexpr(traits::is_nullable) {
+                        if(member.has_value()) {
+                            std::memcpy(destination, std::addressof(*member),
+                                        sizeof(value_type));
+                            validity[i / CHAR_BIT] |=
+                                std::byte{1} << (i % CHAR_BIT);
+                        }
+                    } else {
+                        std::memcpy(destination, std::addressof(member),
+                                    sizeof(value_type));
+                    }
+                }
+
+                sink(detail::index<Indices>{}, column_view{values, validity});
+            }(),
+            ...);
+    }(std::make_index_sequence<data_member_count<T>>{});
+}
+
+// Decodes the given objects from columns, which are obtained by invoking the
+// given source with the index of each non-static data member (as
+// std::integral_constant). Columns must have the format which is produced by
+// the encode_columns function. Columns without values are skipped: the
+// corresponding members are left unchanged. Returns false if a column is too
+// small, in which case the objects are left partially decoded.
+template <columnar T, typename F>
+auto
+decode_columns(std::span<T> rows, F&& source) -> bool {
+    return [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+        return (
+            [&] {
+                using traits = detail::column_traits<member_type_t<T, Indices>>;
+                using value_type = typename traits::value_type;
+
+                auto column = column_view{source(detail::index<Indices>{})};
+                if(column.values.empty()) {
+                    return true;
+                }
+
+                if((column.values.size() < rows.size() * sizeof(value_type)) ||
+                   (traits::is_nullable &&
+                    (column.validity.size() <
+                     detail::bitmap_size(rows.size())))) {
+                    return false;
+                }
+
+                for(auto i = std::size_t{0}; i != rows.size(); ++i) {
+                    auto& member = std::get<Indices>(reflect(rows[i]));
+                    auto data = column.values.data() + i * sizeof(value_type);
+
+                    if constexpr(traits::is_nullable) {
+                        auto mask = std::byte{1} << (i % CHAR_BIT);
+
+                        if((column.validity[i / CHAR_BIT] & mask) ==
+                           std::byte{}) {
+                            member.reset();
+                        } else {
+                            std::memcpy(std::addressof(member.emplace()), data,
+                                        sizeof(value_type));
+                        }
+                    } else {
+                        std::memcpy(
+                            std::addressof(member), data, sizeof(value_type));
+                    }
+                }
+
+                return true;
+            }() &&
+            ...);
+    }(std::make_index_sequence<data_member_count<T>>{});
+}
+
+} // namespace mirror
+
+#endif // H_F489EB9B957E413CA7F8AD77E4E14525
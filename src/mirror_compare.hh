@@ -0,0 +1,402 @@
+// Copyright Nezametdinov E. Ildus 2022.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef H_4B9F54D0B8A94C8DBD35DA3045004D03
+#define H_4B9F54D0B8A94C8DBD35DA3045004D03
+
+#include "mirror_core.hh"
+#include "mirror_stats.hh"
+
+#include <compare>
+#include <cstddef>
+#include <cstring>
+
+#include <memory>
+
+namespace mirror {
+
+////////////////////////////////////////////////////////////////////////////////
+// Comparison plans.
+////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// A predicate which shows if objects of the given type can be compared for
+// equality by comparing their object representations.
+template <typename T>
+constexpr auto is_trivially_comparable =
+    std::has_unique_object_representations_v<T>;
+
+// A predicate which shows if objects of the given type can be compared for
+// equality: the type is trivially comparable, or it is an array of elements or
+// a reflexible type with members which can be compared for equality, or it
+// defines the equality operator.
+template <typename T>
+constexpr auto
+is_equality_comparable() noexcept -> bool {
+    if constexpr(is_trivially_comparable<T>) {
+        return true;
+    } else if constexpr(std::is_array_v<T>) {
+        return is_equality_comparable<
+            std::remove_cv_t<std::remove_extent_t<T>>>();
+    } else if constexpr(reflexible<T>) {
+        if constexpr(has_bit_fields_of<T>) {
+            return false;
+        } else {
+            return []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+                return (is_equality_comparable<
+                            std::remove_cv_t<member_type_t<T, Indices>>>() &&
+                        ...);
+            }(std::make_index_sequence<data_member_count<T>>{});
+        }
+    } else {
+        return std::equality_comparable<T>;
+    }
+}
+
+// A concept for types which order their objects with the less-than operator.
+template <typename T>
+concept less_than_comparable = requires(const T& x, const T& y) {
+    { x < y } -> std::convertible_to<bool>;
+};
+
+// A predicate which shows if objects of the given type can be compared with
+// the three-way comparison: the type is an array of elements or a reflexible
+// type with members which can be compared with the three-way comparison, or it
+// defines the three-way comparison operator or the less-than operator.
+template <typename T>
+constexpr auto
+is_three_way_comparable() noexcept -> bool {
+    if constexpr(std::is_array_v<T>) {
+        return is_three_way_comparable<
+            std::remove_cv_t<std::remove_extent_t<T>>>();
+    } else if constexpr(reflexible<T>) {
+        if constexpr(has_bit_fields_of<T>) {
+            return false;
+        } else {
+            return []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+                return (is_three_way_comparable<
+                            std::remove_cv_t<member_type_t<T, Indices>>>() &&
+                        ...);
+            }(std::make_index_sequence<data_member_count<T>>{});
+        }
+    } else {
+        return std::three_way_comparable<T> || less_than_comparable<T>;
+    }
+}
+
+} // namespace detail
+
+// A concept that models types whose objects can be compared for equality with
+// the equal function.
+template <typename T>
+concept equality_comparable =
+    detail::is_equality_comparable<std::remove_cv_t<T>>();
+
+// A concept that models types whose objects can be compared with the
+// compare_three_way and less functions.
+template <typename T>
+concept three_way_comparable =
+    detail::is_three_way_comparable<std::remove_cv_t<T>>();
+
+namespace detail {
+
+// A plan of equality comparison of objects with the given number of non-static
+// data members (or leaves of structural signatures). For each member the plan
+// holds the number of bytes which are compared with a single call to memcmp,
+// starting from this member. Runs of adjacent trivially comparable members
+// without padding between them are compared at once: the first member of the
+// run holds the size of the run, and the rest of the members are marked as
+// covered by the run.
+template <std::size_t N>
+struct comparison_plan {
+    static constexpr auto n = N;
+
+    std::array<std::size_t, n> run_sizes{};
+    std::array<bool, n> is_covered{};
+};
+
+// Computes the plan of equality comparison of members with the given offsets
+// and sizes, which show if members are trivially comparable. Members can be
+// merged into runs only if their offsets are verified to be the actual ones:
+// otherwise a run might cover padding bytes instead of a member.
+template <std::size_t N>
+constexpr auto
+compute_comparison_plan(const std::array<bool, N>& is_trivial,
+                        const std::array<std::size_t, N>& sizes,
+                        const std::array<std::size_t, N>& offsets,
+                        bool has_verified_offsets) noexcept
+    -> comparison_plan<N> {
+    auto plan = comparison_plan<N>{};
+    auto first = std::size_t{0};
+
+    for(auto i = std::size_t{0}; i != N; ++i) {
+        if(!is_trivial[i]) {
+            continue;
+        }
+
+        if(has_verified_offsets && (i != 0) && is_trivial[i - 1] &&
+           (offsets[i - 1] + sizes[i - 1] == offsets[i])) {
+            plan.run_sizes[first] += sizes[i];
+            plan.is_covered[i] = true;
+            continue;
+        }
+
+        plan.run_sizes[first = i] = sizes[i];
+    }
+
+    return plan;
+}
+
+// Computes the plan of equality comparison of objects of the given type. Runs
+// are only formed if the type has sequential layout, which verifies the
+// computed offsets of its members.
+//
+// clang-format off
+template <typename T>
+constexpr auto
+comparison_plan_of =
+    []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+        constexpr auto n = sizeof...(Indices);
+
+        constexpr auto offsets = [] {
+            if constexpr(has_sequential_layout<T>) {
+                return member_offsets<T>;
+            } else {
+                return std::array<std::size_t, n>{};
+            }
+        }();
+
+        return compute_comparison_plan<n>(
+            {is_trivially_comparable<member_type_t<T, Indices>>...},
+            {sizeof(member_type_t<T, Indices>)...}, offsets,
+            has_sequential_layout<T>);
+    }(std::make_index_sequence<data_member_count<T>>{});
+// clang-format on
+
+// Plan of equality comparison of leaves of objects with the given structural
+// signature. Offsets of leaves are verified, since signatures only exist for
+// types with computable layout.
+template <typename Signature>
+constexpr auto structure_comparison_plan_of = nullptr;
+
+template <typename... Leaves>
+constexpr auto structure_comparison_plan_of<type_list<Leaves...>> =
+    compute_comparison_plan<sizeof...(Leaves)>(
+        {is_trivially_comparable<typename Leaves::type>...},
+        {sizeof(typename Leaves::type)...}, {Leaves::offset...}, true);
+
+template <typename T>
+auto
+equal_objects(const T& x, const T& y) -> bool;
+
+// Compares leaves of the objects with the given structural signature, which
+// are located at the given addresses, for equality.
+template <typename... Leaves>
+auto
+equal_structures(type_list<Leaves...>, const std::byte* px,
+                 const std::byte* py) -> bool {
+    constexpr auto& plan = structure_comparison_plan_of<type_list<Leaves...>>;
+
+    return [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+        return ([&] {
+            constexpr auto offset = Leaves::offset;
+
+            if constexpr(plan.is_covered[Indices]) {
+                return true;
+            } else if constexpr(plan.run_sizes[Indices] != 0) {
+                return std::memcmp(px + offset, py + offset,
+                                   plan.run_sizes[Indices]) == 0;
+            } else {
+                return equal_objects(
+                    leaf_at<Leaves>(px), leaf_at<Leaves>(py));
+            }
+        }() && ...);
+    }(std::index_sequence_for<Leaves...>{});
+}
+
+// Compares the given objects for equality.
+template <typename T>
+auto
+equal_objects(const T& x, const T& y) -> bool {
+    if constexpr(is_trivially_comparable<T>) {
+        return std::memcmp(std::addressof(x), std::addressof(y), sizeof(T)) ==
+               0;
+    } else if constexpr(std::is_array_v<T>) {
+        for(auto i = std::size_t{0}; i != std::extent_v<T>; ++i) {
+            if(!equal_objects(x[i], y[i])) {
+                return false;
+            }
+        }
+
+        return true;
+    } else if constexpr(structurally_erasable<T>) {
+        // Types with equal structural signatures share the implementation.
+        return equal_structures(
+            structural_signature<T>{},
+            reinterpret_cast<const std::byte*>(std::addressof(x)),
+            reinterpret_cast<const std::byte*>(std::addressof(y)));
+    } else if constexpr(reflexible<T>) {
+        auto tx = reflect(x);
+        auto ty = reflect(y);
+
+        return [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+            constexpr auto& plan = comparison_plan_of<T>;
+
+            return ([&] {
+                if constexpr(plan.is_covered[Indices]) {
+                    return true;
+                } else if constexpr(plan.run_sizes[Indices] != 0) {
+                    return std::memcmp(std::addressof(std::get<Indices>(tx)),
+                                       std::addressof(std::get<Indices>(ty)),
+                                       plan.run_sizes[Indices]) == 0;
+                } else {
+                    return equal_objects(
+                        std::get<Indices>(tx), std::get<Indices>(ty));
+                }
+            }() && ...);
+        }(std::make_index_sequence<data_member_count<T>>{});
+    } else {
+        return x == y;
+    }
+}
+
+template <typename T>
+constexpr auto
+compare_objects(const T& x, const T& y);
+
+// Performs three-way comparison of leaves of the objects with the given
+// structural signature, which are located at the given addresses.
+template <typename... Leaves>
+auto
+compare_structures(type_list<Leaves...>, const std::byte* px,
+                   const std::byte* py) {
+    using result = std::common_comparison_category_t<decltype(compare_objects(
+        leaf_at<Leaves>(px), leaf_at<Leaves>(py)))...>;
+
+    // Leaves are compared in order, until the first pair of leaves which are
+    // not equivalent.
+    auto r = result{std::strong_ordering::equivalent};
+    (((r = compare_objects(leaf_at<Leaves>(px), leaf_at<Leaves>(py))) != 0) ||
+     ...);
+
+    return r;
+}
+
+// Compares the given objects, and returns the result of three-way comparison.
+template <typename T>
+constexpr auto
+compare_objects(const T& x, const T& y) {
+    if constexpr(std::is_array_v<T>) {
+        using result = decltype(compare_objects(x[0], y[0]));
+
+        for(auto i = std::size_t{0}; i != std::extent_v<T>; ++i) {
+            if(auto r = result{compare_objects(x[i], y[i])}; r != 0) {
+                return r;
+            }
+        }
+
+        return result::equivalent;
+    } else if constexpr(reflexible<T>) {
+        if constexpr(structurally_erasable<T>) {
+            // Types with equal structural signatures share the implementation,
+            // which can not be used in constant expressions.
+            if(!std::is_constant_evaluated()) {
+                return compare_structures(
+                    structural_signature<T>{},
+                    reinterpret_cast<const std::byte*>(std::addressof(x)),
+                    reinterpret_cast<const std::byte*>(std::addressof(y)));
+            }
+        }
+
+        auto tx = reflect(x);
+        auto ty = reflect(y);
+
+        return [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+            using result = std::common_comparison_category_t<decltype(
+                compare_objects(std::get<Indices>(tx),
+                                std::get<Indices>(ty)))...>;
+
+            // Members are compared in declaration order, until the first pair
+            // of members which are not equivalent.
+            auto r = result{std::strong_ordering::equivalent};
+            (((r = compare_objects(std::get<Indices>(tx),
+                                   std::get<Indices>(ty))) != 0) ||
+             ...);
+
+            return r;
+        }(std::make_index_sequence<data_member_count<T>>{});
+    } else if constexpr(std::three_way_comparable<T>) {
+        return x <=> y;
+    } else {
+        // Types which only define the less-than operator are weakly ordered.
+        return (x < y) ? std::weak_ordering::less
+                       : ((y < x) ? std::weak_ordering::greater
+                                  : std::weak_ordering::equivalent);
+    }
+}
+
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////
+// Comparison.
+////////////////////////////////////////////////////////////////////////////////
+
+// Compares the given objects for equality. Objects of reflexible types are
+// compared member-wise, as if with a defaulted equality operator which is
+// applied recursively to reflexible members. Runs of adjacent members with
+// unique object representations are compared with a single call to memcmp.
+// Exceptions which are thrown by equality operators of members are propagated.
+template <equality_comparable T>
+auto
+equal(const T& x, const T& y) -> bool {
+    [[maybe_unused]] auto scope =
+        detail::stats_scope<T, detail::operation::compare>{
+            sizeof(T), detail::is_trivially_comparable<T>};
+
+    return detail::equal_objects(x, y);
+}
+
+// A function object which compares objects for equality with the equal
+// function. Together with the hasher function object from the mirror_hash.hh
+// header it lets unordered containers use reflexible types without equality
+// operators as keys.
+struct equal_to {
+    template <equality_comparable T>
+    auto
+    operator()(const T& x, const T& y) const -> bool {
+        return mirror::equal(x, y);
+    }
+};
+
+// Performs lexicographic three-way comparison of the given objects. Objects of
+// reflexible types are compared member-wise in declaration order, as if with a
+// defaulted three-way comparison operator which is applied recursively to
+// reflexible members. Members of types which only define the less-than
+// operator are weakly ordered. Exceptions which are thrown by comparison
+// operators of members are propagated.
+template <three_way_comparable T>
+constexpr auto
+compare_three_way(const T& x, const T& y) {
+    [[maybe_unused]] auto scope =
+        detail::stats_scope<T, detail::operation::compare>{sizeof(T), false};
+
+    return detail::compare_objects(x, y);
+}
+
+// Checks if the first object is less than the second one, according to the
+// result of the compare_three_way function.
+template <three_way_comparable T>
+constexpr auto
+less(const T& x, const T& y) -> bool {
+    [[maybe_unused]] auto scope =
+        detail::stats_scope<T, detail::operation::compare>{sizeof(T), false};
+
+    return detail::compare_objects(x, y) < 0;
+}
+
+} // namespace mirror
+
+#endif // H_4B9F54D0B8A94C8DBD35DA3045004D03
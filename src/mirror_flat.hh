@@ -0,0 +1,77 @@
+// Copyright Nezametdinov E. Ildus 2022.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef H_589EB7581BD249A9A52F5B6B2553E490
+#define H_589EB7581BD249A9A52F5B6B2553E490
+
+#include "mirror_core.hh"
+
+#include <cstddef>
+
+namespace mirror {
+
+////////////////////////////////////////////////////////////////////////////////
+// Flattening.
+////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// Counts the number of leaves in the given type. Leaves are objects which are
+// neither arrays, nor objects of reflexible types. Elements of arrays and
+// non-static data members of reflexible types are flattened recursively.
+template <typename T>
+constexpr auto
+count_leaves() noexcept -> std::size_t {
+    if constexpr(std::is_array_v<T>) {
+        return std::extent_v<T> * count_leaves<std::remove_extent_t<T>>();
+    } else if constexpr(reflexible<T>) {
+        return []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+            return (std::size_t{0} + ... +
+                    count_leaves<member_type_t<T, Indices>>());
+        }(std::make_index_sequence<data_member_count<T>>{});
+    } else {
+        return 1;
+    }
+}
+
+// Returns a tuple of references to leaves of the given object.
+template <typename T>
+constexpr auto
+flatten(T& x) noexcept {
+    if constexpr(std::is_array_v<T>) {
+        return [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+            return std::tuple_cat(flatten(x[Indices])...);
+        }(std::make_index_sequence<std::extent_v<T>>{});
+    } else if constexpr(reflexible<T>) {
+        return std::apply(
+            [](auto&... members) {
+                return std::tuple_cat(flatten(members)...);
+            },
+            reflect(x));
+    } else {
+        return std::tie(x);
+    }
+}
+
+} // namespace detail
+
+// Number of leaves in the given type: non-static data members which are
+// neither arrays, nor objects of reflexible types, found by recursively
+// descending into members of reflexible types and into elements of arrays.
+template <reflexible T>
+constexpr auto flat_member_count = detail::count_leaves<std::remove_cv_t<T>>();
+
+// Returns a tuple of references to leaves of the given object, in declaration
+// order (elements of arrays come in the order of their indices). If the object
+// is const, then the references are const.
+template <reflexible T>
+constexpr auto
+flat_reflect(T& x) noexcept {
+    return detail::flatten(x);
+}
+
+} // namespace mirror
+
+#endif // H_589EB7581BD249A9A52F5B6B2553E490
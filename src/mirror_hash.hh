@@ -0,0 +1,261 @@
+// Copyright Nezametdinov E. Ildus 2022.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef H_1E2FA90808A446BF9502750D906A3018
+#define H_1E2FA90808A446BF9502750D906A3018
+
+#include "mirror_core.hh"
+#include "mirror_stats.hh"
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <functional>
+#include <memory>
+#include <ranges>
+
+namespace mirror {
+
+////////////////////////////////////////////////////////////////////////////////
+// Hashing primitives.
+////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// Multipliers of the hash function (the same as in xxHash64).
+constexpr auto hash_prime_0 = std::uint64_t{0x9E3779B185EBCA87};
+constexpr auto hash_prime_1 = std::uint64_t{0xC2B2AE3D27D4EB4F};
+constexpr auto hash_prime_2 = std::uint64_t{0x165667B19E3779F9};
+
+// Initial state of the hash function.
+constexpr auto hash_seed = std::uint64_t{0x27D4EB2F165667C5};
+
+// Mixes the given 64-bit word into the given state of the hash function.
+constexpr auto
+hash_round(std::uint64_t h, std::uint64_t word) noexcept -> std::uint64_t {
+    return std::rotl(h ^ (word * hash_prime_1), 31) * hash_prime_0;
+}
+
+// Computes the final hash value from the given state of the hash function.
+constexpr auto
+hash_finalize(std::uint64_t h) noexcept -> std::uint64_t {
+    h = (h ^ (h >> 33)) * hash_prime_1;
+    h = (h ^ (h >> 29)) * hash_prime_2;
+    return h ^ (h >> 32);
+}
+
+// Mixes the given sequence of bytes into the given state of the hash function.
+// The sequence is processed in 64-bit words, the last word is padded with
+// zeros. Since sizes of objects are known at compile time, calls with constant
+// sizes are expected to be fully unrolled.
+inline auto
+hash_bytes(const std::byte* data, std::size_t size, std::uint64_t h) noexcept
+    -> std::uint64_t {
+    for(; size >= sizeof(std::uint64_t); size -= sizeof(std::uint64_t)) {
+        auto word = std::uint64_t{};
+        std::memcpy(&word, data, sizeof(word));
+
+        h = hash_round(h, word);
+        data += sizeof(word);
+    }
+
+    if(size != 0) {
+        auto word = std::uint64_t{};
+        std::memcpy(&word, data, size);
+
+        h = hash_round(h, word);
+    }
+
+    return h;
+}
+
+// A concept which holds if objects of the given type can be hashed with the
+// std::hash specialization.
+template <typename T>
+concept std_hashable = requires(const T& x) {
+    { std::hash<T>{}(x) } -> std::convertible_to<std::size_t>;
+};
+
+// A predicate which shows if objects of the given type can be hashed: the type
+// has unique object representations, or it is an array or a range of hashable
+// elements, or a reflexible type with hashable members, or it has a std::hash
+// specialization.
+template <typename T>
+constexpr auto
+is_hashable() noexcept -> bool {
+    if constexpr(std::has_unique_object_representations_v<T>) {
+        return true;
+    } else if constexpr(std::is_array_v<T>) {
+        return is_hashable<std::remove_cv_t<std::remove_extent_t<T>>>();
+    } else if constexpr(reflexible<T>) {
+        if constexpr(has_bit_fields_of<T>) {
+            return false;
+        } else {
+            return []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+                return (is_hashable<
+                            std::remove_cv_t<member_type_t<T, Indices>>>() &&
+                        ...);
+            }(std::make_index_sequence<data_member_count<T>>{});
+        }
+    } else if constexpr(std_hashable<T>) {
+        return true;
+    } else if constexpr(std::ranges::input_range<const T>) {
+        return is_hashable<std::ranges::range_value_t<const T>>();
+    } else {
+        return false;
+    }
+}
+
+} // namespace detail
+
+// A concept that models types whose objects can be hashed.
+template <typename T>
+concept hashable = detail::is_hashable<std::remove_cv_t<T>>();
+
+namespace detail {
+
+template <typename T>
+auto
+hash_object(const T& x, std::uint64_t h) noexcept -> std::uint64_t;
+
+// Mixes leaves of the object with the given structural signature, which is
+// located at the given address, into the given state of the hash function.
+// Leaves are read at their offsets, which are verified for all structurally
+// erasable types.
+template <typename... Leaves>
+auto
+hash_structure(type_list<Leaves...>, const std::byte* p,
+               std::uint64_t h) noexcept -> std::uint64_t {
+    ((h = hash_object(leaf_at<Leaves>(p), h)), ...);
+    return h;
+}
+
+// Mixes the given object into the given state of the hash function.
+template <typename T>
+auto
+hash_object(const T& x, std::uint64_t h) noexcept -> std::uint64_t {
+    if constexpr(std::has_unique_object_representations_v<T>) {
+        // Objects which are equal have equal object representations, so all
+        // their bytes are hashed in a single pass.
+        return hash_bytes(
+            reinterpret_cast<const std::byte*>(std::addressof(x)), sizeof(T),
+            h);
+    } else if constexpr(std::is_array_v<T>) {
+        for(auto& element : x) {
+            h = hash_object(element, h);
+        }
+
+        return h;
+    } else if constexpr(structurally_erasable<T>) {
+        // Types with equal structural signatures share the implementation.
+        return hash_structure(
+            structural_signature<T>{},
+            reinterpret_cast<const std::byte*>(std::addressof(x)), h);
+    } else if constexpr(reflexible<T>) {
+        return std::apply(
+            [h](auto&... members) mutable {
+                ((h = hash_object(members, h)), ...);
+                return h;
+            },
+            reflect(x));
+    } else if constexpr(std_hashable<T>) {
+        return hash_round(h, std::hash<T>{}(x));
+    } else {
+        // Ranges are hashed element-wise, followed by the number of elements,
+        // so that concatenations of ranges with different boundaries differ.
+        auto n = std::uint64_t{0};
+        for(auto& element : x) {
+            h = hash_object(element, h);
+            ++n;
+        }
+
+        return hash_round(h, n);
+    }
+}
+
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////
+// Hashing.
+////////////////////////////////////////////////////////////////////////////////
+
+// Computes the hash value of the given object. Objects with unique object
+// representations are hashed as sequences of bytes. Objects of other reflexible
+// types are hashed member-wise (types with structural signatures are hashed
+// leaf by leaf), objects of types with std::hash specializations are hashed
+// with them, and ranges without such specializations are hashed element-wise.
+template <hashable T>
+auto
+hash(const T& x) noexcept -> std::size_t {
+    [[maybe_unused]] auto scope =
+        detail::stats_scope<T, detail::operation::hash>{
+            sizeof(T), std::has_unique_object_representations_v<T>};
+
+    return static_cast<std::size_t>(
+        detail::hash_finalize(detail::hash_object(x, detail::hash_seed)));
+}
+
+// A function object which computes hash values of objects with the hash
+// function. Can be used as a hash function of unordered containers, together
+// with the equal_to function object from the mirror_compare.hh header.
+struct hasher {
+    template <hashable T>
+    auto
+    operator()(const T& x) const noexcept -> std::size_t {
+        return mirror::hash(x);
+    }
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Layout fingerprints.
+////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// Mixes the description of the layout of the given type into the given state
+// of the hash function. The description includes the kind, size and alignment
+// of the type. For arrays it also includes the number of elements and the
+// layout of elements, and for types with computable layout: the number of
+// non-static data members, and offsets and layouts of these members.
+template <typename T>
+constexpr auto
+hash_layout(std::uint64_t h) noexcept -> std::uint64_t {
+    h = hash_round(h, static_cast<std::uint64_t>(kind_of<T>()));
+    h = hash_round(h, sizeof(T));
+    h = hash_round(h, alignof(T));
+
+    if constexpr(std::is_array_v<T>) {
+        h = hash_round(h, std::extent_v<T>);
+        h = hash_layout<std::remove_extent_t<T>>(h);
+    } else if constexpr(layout_computable<T>) {
+        h = hash_round(h, data_member_count<T>);
+        [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+            ((h = hash_layout<member_type_t<T, Indices>>(
+                  hash_round(h, member_offsets<T>[Indices]))),
+             ...);
+        }(std::make_index_sequence<data_member_count<T>>{});
+    }
+
+    return h;
+}
+
+} // namespace detail
+
+// A 64-bit fingerprint of the layout of the given type. Types have equal
+// fingerprints if they have the same size and alignment, and if their
+// non-static data members have the same offsets, sizes, alignments and kinds of
+// types (recursively, for members of reflexible types and arrays). Objects can
+// be copied as sequences of bytes between programs which agree on the
+// fingerprint of their type.
+template <layout_computable T>
+constexpr auto layout_fingerprint =
+    detail::hash_finalize(detail::hash_layout<std::remove_cv_t<T>>(
+        detail::hash_seed));
+
+} // namespace mirror
+
+#endif // H_1E2FA90808A446BF9502750D906A3018
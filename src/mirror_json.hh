@@ -0,0 +1,658 @@
+// Copyright Nezametdinov E. Ildus 2022.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef H_6E38F27476E542AE9F815F5778FF97F0
+#define H_6E38F27476E542AE9F815F5778FF97F0
+
+#include "mirror_core.hh"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+
+namespace mirror {
+
+////////////////////////////////////////////////////////////////////////////////
+// Member names.
+////////////////////////////////////////////////////////////////////////////////
+
+// A customization point which holds names of non-static data members of the
+// given type, in declaration order. Objects of types with names are encoded as
+// JSON objects, and objects of other reflexible types as JSON arrays. Names are
+// written as is, so they must not contain characters which have to be escaped.
+// A specialization must be visible wherever the type is encoded, e.g.:
+//
+//     template <>
+//     constexpr auto mirror::member_names<point> =
+//         std::array<std::string_view, 2>{"x", "y"};
+//
+template <typename T>
+constexpr auto member_names = std::array<std::string_view, 0>{};
+
+namespace detail {
+
+// A predicate which shows if the given type has names of its members.
+template <typename T>
+constexpr auto has_member_names = [] {
+    constexpr auto n = member_names<T>.size();
+    static_assert((n == 0) || (n == data_member_count<T>),
+                  "The number of member names does not match the number of "
+                  "non-static data members.");
+
+    return (n != 0);
+}();
+
+////////////////////////////////////////////////////////////////////////////////
+// JSON output plans.
+////////////////////////////////////////////////////////////////////////////////
+
+// Constant fragments of JSON representations of objects of the given type. The
+// fragment with the index i < N (where N is the number of members) precedes
+// the member with the index i: it holds the opening bracket or the separator,
+// and the name of the member. The last fragment holds the closing bracket.
+template <typename T>
+struct json_plan {
+    static constexpr auto n = data_member_count<T>;
+
+    // Computes the total size of fragments.
+    static constexpr auto
+    compute_size() noexcept -> std::size_t {
+        auto size = std::size_t{2} + ((n != 0) ? (n - 1) : 0);
+
+        if constexpr(has_member_names<T>) {
+            for(auto name : member_names<T>) {
+                size += name.size() + 3;
+            }
+        }
+
+        return size;
+    }
+
+    std::array<char, compute_size()> text;
+    std::array<std::size_t, n + 2> offsets;
+
+    // Returns the fragment with the given index.
+    constexpr auto
+    operator[](std::size_t i) const noexcept -> std::string_view {
+        return {text.data() + offsets[i], offsets[i + 1] - offsets[i]};
+    }
+};
+
+// Computes the output plan of objects of the given type.
+template <typename T>
+constexpr auto
+compute_json_plan() noexcept -> json_plan<T> {
+    constexpr auto n = data_member_count<T>;
+    constexpr auto brackets =
+        has_member_names<T> ? std::string_view{"{}"} : std::string_view{"[]"};
+
+    auto plan = json_plan<T>{};
+    auto size = std::size_t{0};
+
+    auto append = [&](std::string_view s) {
+        for(auto c : s) {
+            plan.text[size++] = c;
+        }
+    };
+
+    for(auto i = std::size_t{0}; i != n; ++i) {
+        plan.offsets[i] = size;
+        append((i == 0) ? brackets.substr(0, 1) : std::string_view{","});
+
+        if constexpr(has_member_names<T>) {
+            append("\"");
+            append(member_names<T>[i]);
+            append("\":");
+        }
+    }
+
+    plan.offsets[n] = size;
+    append((n == 0) ? brackets : brackets.substr(1));
+    plan.offsets[n + 1] = size;
+
+    return plan;
+}
+
+// Output plan of objects of the given type.
+template <typename T>
+constexpr auto json_plan_of = compute_json_plan<T>();
+
+////////////////////////////////////////////////////////////////////////////////
+// JSON traits.
+////////////////////////////////////////////////////////////////////////////////
+
+// A predicate which shows if the given type is an array of characters. Such
+// arrays are encoded as JSON strings which hold characters up to the first null
+// character, or all characters if the array has no null characters.
+template <typename T>
+constexpr auto is_char_array =
+    (std::rank_v<T> == 1) && std::same_as<std::remove_extent_t<T>, char>;
+
+// A concept for types whose objects are encoded as JSON strings.
+template <typename T>
+concept json_string = !std::is_arithmetic_v<T> && !is_char_array<T> &&
+                      std::convertible_to<const T&, std::string_view>;
+
+// A predicate which is only used to produce diagnostics for unsupported types.
+template <typename T>
+constexpr auto is_json_supported = false;
+
+////////////////////////////////////////////////////////////////////////////////
+// JSON encoding.
+////////////////////////////////////////////////////////////////////////////////
+
+// A writer which appends characters to a buffer.
+struct json_writer {
+    char* position;
+    char* end;
+
+    // Appends the given string. Returns false if the buffer is too small.
+    auto
+    put(std::string_view s) noexcept -> bool {
+        if(static_cast<std::size_t>(end - position) < s.size()) {
+            return false;
+        }
+
+        position = std::copy(s.begin(), s.end(), position);
+        return true;
+    }
+
+    // Appends the given string as a JSON string literal.
+    auto
+    put_string(std::string_view s) noexcept -> bool {
+        constexpr auto digits = std::string_view{"0123456789abcdef"};
+
+        if(!put("\"")) {
+            return false;
+        }
+
+        for(auto c : s) {
+            auto u = static_cast<unsigned char>(c);
+            auto is_written = true;
+
+            if(c == '"') {
+                is_written = put("\\\"");
+            } else if(c == '\\') {
+                is_written = put("\\\\");
+            } else if(u < 0x20) {
+                char escape[] = {'\\', 'u', '0', '0', digits[u >> 4],
+                                 digits[u & 0xF]};
+                is_written = put({escape, sizeof(escape)});
+            } else {
+                is_written = put({&c, 1});
+            }
+
+            if(!is_written) {
+                return false;
+            }
+        }
+
+        return put("\"");
+    }
+};
+
+// Writes the JSON representation of the given object. Returns false if the
+// buffer is too small.
+template <typename T>
+auto
+write_json(json_writer& w, const T& x) noexcept -> bool {
+    if constexpr(std::same_as<T, bool>) {
+        return w.put(x ? "true" : "false");
+    } else if constexpr(std::is_arithmetic_v<T>) {
+        if constexpr(std::is_floating_point_v<T>) {
+            // JSON has no representation of infinities and NaNs, so they are
+            // written as strings, which std::from_chars parses back.
+            if(!std::isfinite(x)) {
+                if(!w.put("\"")) {
+                    return false;
+                }
+
+                auto [position, error] = std::to_chars(w.position, w.end, x);
+                w.position = position;
+
+                return (error == std::errc{}) && w.put("\"");
+            }
+        }
+
+        auto [position, error] = std::to_chars(w.position, w.end, x);
+        w.position = position;
+
+        return error == std::errc{};
+    } else if constexpr(std::is_enum_v<T>) {
+        return write_json(w, static_cast<std::underlying_type_t<T>>(x));
+    } else if constexpr(is_specialization_of<T, std::optional>) {
+        return x.has_value() ? write_json(w, *x) : w.put("null");
+    } else if constexpr(is_char_array<T>) {
+        auto s = std::string_view{x, std::extent_v<T>};
+        return w.put_string(s.substr(0, s.find('\0')));
+    } else if constexpr(json_string<T>) {
+        return w.put_string(std::string_view{x});
+    } else if constexpr(std::is_array_v<T>) {
+        for(auto i = std::size_t{0}; i != std::extent_v<T>; ++i) {
+            if(!w.put((i == 0) ? "[" : ",") || !write_json(w, x[i])) {
+                return false;
+            }
+        }
+
+        return w.put((std::extent_v<T> == 0) ? "[]" : "]");
+    } else if constexpr(reflexible<T>) {
+        constexpr auto& plan = json_plan_of<T>;
+
+        return [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+            [[maybe_unused]] auto members = reflect(x);
+
+            return ((w.put(plan[Indices]) &&
+                     write_json(w, std::get<Indices>(members))) &&
+                    ...) &&
+                   w.put(plan[sizeof...(Indices)]);
+        }(std::make_index_sequence<data_member_count<T>>{});
+    } else {
+        static_assert(is_json_supported<T>, "The type is not supported.");
+    }
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// JSON parsing.
+////////////////////////////////////////////////////////////////////////////////
+
+// A reader which consumes characters from a buffer.
+struct json_reader {
+    const char* position;
+    const char* end;
+
+    // Skips whitespace characters.
+    void
+    skip_whitespace() noexcept {
+        constexpr auto whitespace = std::string_view{" \t\n\r"};
+
+        while((position != end) &&
+              (whitespace.find(*position) != std::string_view::npos)) {
+            ++position;
+        }
+    }
+
+    // Consumes the given string, which may be preceded by whitespace
+    // characters. Returns false if the buffer does not contain the string.
+    auto
+    consume(std::string_view s) noexcept -> bool {
+        skip_whitespace();
+
+        if((static_cast<std::size_t>(end - position) < s.size()) ||
+           (std::string_view{position, s.size()} != s)) {
+            return false;
+        }
+
+        position += s.size();
+        return true;
+    }
+
+    // Checks if the next character after whitespace characters is the given
+    // one. Does not consume the character.
+    auto
+    peek(char c) noexcept -> bool {
+        skip_whitespace();
+        return (position != end) && (*position == c);
+    }
+
+    // Consumes a string literal without decoding escape sequences. Returns its
+    // contents, or an empty optional if the buffer does not contain a string
+    // literal.
+    auto
+    consume_raw_string() noexcept -> std::optional<std::string_view> {
+        if(!consume("\"")) {
+            return std::nullopt;
+        }
+
+        for(auto first = position; position != end; ++position) {
+            if(*position == '\\') {
+                if(++position == end) {
+                    break;
+                }
+            } else if(*position == '"') {
+                auto size = static_cast<std::size_t>((position++) - first);
+                return std::string_view{first, size};
+            }
+        }
+
+        return std::nullopt;
+    }
+
+    // Consumes a string literal, and stores its decoded contents in the given
+    // string. Returns false if the buffer does not contain a valid literal.
+    auto
+    consume_string(std::string& s) -> bool {
+        auto raw = consume_raw_string();
+        if(!raw) {
+            return false;
+        }
+
+        s.clear();
+        s.reserve(raw->size());
+
+        for(auto i = std::size_t{0}; i != raw->size(); ++i) {
+            if((*raw)[i] != '\\') {
+                s.push_back((*raw)[i]);
+                continue;
+            }
+
+            switch((*raw)[++i]) {
+                case 'b':
+                    s.push_back('\b');
+                    break;
+                case 'f':
+                    s.push_back('\f');
+                    break;
+                case 'n':
+                    s.push_back('\n');
+                    break;
+                case 'r':
+                    s.push_back('\r');
+                    break;
+                case 't':
+                    s.push_back('\t');
+                    break;
+                case 'u': {
+                    auto code_point = std::uint32_t{};
+                    if(!decode_code_point(*raw, i, code_point)) {
+                        return false;
+                    }
+
+                    append_utf8(s, code_point);
+                    break;
+                }
+                default:
+                    s.push_back((*raw)[i]);
+                    break;
+            }
+        }
+
+        return true;
+    }
+
+    // Skips a JSON value. Returns false if the buffer does not contain a
+    // value.
+    auto
+    skip_value() noexcept -> bool {
+        skip_whitespace();
+        if(position == end) {
+            return false;
+        }
+
+        if(*position == '"') {
+            return consume_raw_string().has_value();
+        }
+
+        if((*position == '[') || (*position == '{')) {
+            auto depth = std::size_t{0};
+
+            while(position != end) {
+                if(*position == '"') {
+                    if(!consume_raw_string()) {
+                        return false;
+                    }
+
+                    continue;
+                }
+
+                if((*position == '[') || (*position == '{')) {
+                    ++depth;
+                } else if((*position == ']') || (*position == '}')) {
+                    if(--depth == 0) {
+                        ++position;
+                        return true;
+                    }
+                }
+
+                ++position;
+            }
+
+            return false;
+        }
+
+        // Numbers and literals end with separators, closing brackets or
+        // whitespace characters.
+        auto first = position;
+        while((position != end) && (std::string_view{",]} \t\n\r"}.find(
+                                        *position) == std::string_view::npos)) {
+            ++position;
+        }
+
+        return position != first;
+    }
+
+private:
+    // Decodes the code point of the escape sequence \uXXXX (possibly followed
+    // by the second escape sequence of a surrogate pair), which starts at the
+    // given index of the given string. Advances the index to the last digit.
+    static auto
+    decode_code_point(std::string_view s, std::size_t& i,
+                      std::uint32_t& code_point) noexcept -> bool {
+        auto read_unit = [&](std::uint32_t& unit) {
+            if(s.size() - i < 5) {
+                return false;
+            }
+
+            auto digits = s.data() + i + 1;
+            auto [last, error] = std::from_chars(digits, digits + 4, unit, 16);
+            i += 4;
+
+            return (error == std::errc{}) && (last == digits + 4);
+        };
+
+        if(!read_unit(code_point)) {
+            return false;
+        }
+
+        if((code_point >= 0xD800) && (code_point < 0xDC00)) {
+            auto low = std::uint32_t{};
+            if((s.size() - i < 3) || (s[i + 1] != '\\') || (s[i + 2] != 'u')) {
+                return false;
+            }
+
+            i += 2;
+            if(!read_unit(low) || (low < 0xDC00) || (low >= 0xE000)) {
+                return false;
+            }
+
+            code_point =
+                0x10000 + ((code_point - 0xD800) << 10) + (low - 0xDC00);
+        }
+
+        return true;
+    }
+
+    // Appends the UTF-8 encoding of the given code point to the given string.
+    static void
+    append_utf8(std::string& s, std::uint32_t c) {
+        if(c < 0x80) {
+            s.push_back(static_cast<char>(c));
+        } else if(c < 0x800) {
+            s.push_back(static_cast<char>(0xC0 | (c >> 6)));
+            s.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+        } else if(c < 0x10000) {
+            s.push_back(static_cast<char>(0xE0 | (c >> 12)));
+            s.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
+            s.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+        } else {
+            s.push_back(static_cast<char>(0xF0 | (c >> 18)));
+            s.push_back(static_cast<char>(0x80 | ((c >> 12) & 0x3F)));
+            s.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
+            s.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+        }
+    }
+};
+
+// Reads the given object from its JSON representation. Returns false if the
+// buffer does not contain a valid representation.
+template <typename T>
+auto
+read_json(json_reader& r, T& x) -> bool {
+    if constexpr(std::same_as<T, bool>) {
+        if(r.consume("true")) {
+            x = true;
+            return true;
+        }
+
+        if(r.consume("false")) {
+            x = false;
+            return true;
+        }
+
+        return false;
+    } else if constexpr(std::is_arithmetic_v<T>) {
+        if constexpr(std::is_floating_point_v<T>) {
+            // Infinities and NaNs are written as strings.
+            if(r.peek('"')) {
+                auto s = r.consume_raw_string();
+                if(!s) {
+                    return false;
+                }
+
+                auto last = s->data() + s->size();
+                auto [position, error] = std::from_chars(s->data(), last, x);
+
+                return (error == std::errc{}) && (position == last) &&
+                       !std::isfinite(x);
+            }
+        }
+
+        r.skip_whitespace();
+
+        auto [position, error] = std::from_chars(r.position, r.end, x);
+        r.position = position;
+
+        return error == std::errc{};
+    } else if constexpr(std::is_enum_v<T>) {
+        auto value = std::underlying_type_t<T>{};
+        if(!read_json(r, value)) {
+            return false;
+        }
+
+        x = static_cast<T>(value);
+        return true;
+    } else if constexpr(is_specialization_of<T, std::optional>) {
+        if(r.consume("null")) {
+            x.reset();
+            return true;
+        }
+
+        return read_json(r, x.has_value() ? *x : x.emplace());
+    } else if constexpr(std::same_as<T, std::string>) {
+        return r.consume_string(x);
+    } else if constexpr(is_char_array<T>) {
+        // Characters after the end of the string are zeroed. Strings which do
+        // not fit in the array are rejected.
+        auto s = std::string{};
+        if(!r.consume_string(s) || (s.size() > std::extent_v<T>)) {
+            return false;
+        }
+
+        std::fill(std::copy(s.begin(), s.end(), x), x + std::extent_v<T>, '\0');
+        return true;
+    } else if constexpr(std::is_array_v<T>) {
+        for(auto i = std::size_t{0}; i != std::extent_v<T>; ++i) {
+            if(!r.consume((i == 0) ? "[" : ",") || !read_json(r, x[i])) {
+                return false;
+            }
+        }
+
+        return (std::extent_v<T> == 0) ? (r.consume("[") && r.consume("]"))
+                                       : r.consume("]");
+    } else if constexpr(reflexible<T> && !has_member_names<T>) {
+        return [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+            [[maybe_unused]] auto members = reflect(x);
+
+            return r.consume("[") &&
+                   ((((Indices == 0) || r.consume(",")) &&
+                     read_json(r, std::get<Indices>(members))) &&
+                    ...) &&
+                   r.consume("]");
+        }(std::make_index_sequence<data_member_count<T>>{});
+    } else if constexpr(reflexible<T>) {
+        // Members may come in any order, and unknown members are skipped.
+        auto members = reflect(x);
+
+        auto read_member = [&]<std::size_t... Indices>(
+                               std::string_view name,
+                               std::index_sequence<Indices...>) {
+            auto is_found = false;
+            auto is_read = (((member_names<T>[Indices] == name)
+                                 ? (is_found = true,
+                                    read_json(r, std::get<Indices>(members)))
+                                 : true) &&
+                            ...);
+
+            return is_found ? is_read : r.skip_value();
+        };
+
+        if(!r.consume("{")) {
+            return false;
+        }
+
+        if(r.consume("}")) {
+            return true;
+        }
+
+        do {
+            auto name = r.consume_raw_string();
+            if(!name || !r.consume(":") ||
+               !read_member(
+                   *name, std::make_index_sequence<data_member_count<T>>{})) {
+                return false;
+            }
+        } while(r.consume(","));
+
+        return r.consume("}");
+    } else {
+        static_assert(is_json_supported<T>, "The type is not supported.");
+    }
+}
+
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////
+// JSON encoding and parsing.
+////////////////////////////////////////////////////////////////////////////////
+
+// Writes the JSON representation of the given object to the given buffer.
+// Objects of reflexible types are written as arrays of their non-static data
+// members, or as objects if the member_names customization point is
+// specialized for their types. Arrays are written as JSON arrays, optional
+// objects as null or their values, strings and arrays of characters as JSON
+// strings, enumerations as their underlying values, and numbers are formatted
+// with std::to_chars (infinities and NaNs are written as strings). The
+// function does not allocate memory. Returns the number of written characters,
+// or zero if the buffer is too small.
+template <reflexible T>
+auto
+to_json(const T& x, std::span<char> out) noexcept -> std::size_t {
+    auto w = detail::json_writer{out.data(), out.data() + out.size()};
+    return detail::write_json(w, x) ? std::size_t(w.position - out.data()) : 0;
+}
+
+// Reads the given object from the JSON representation at the beginning of the
+// given string, which has the format produced by the to_json function. Members
+// which are absent from JSON objects are left unchanged. Returns the number of
+// consumed characters, so that consecutive representations can be read from
+// a stream of them, or zero if the string does not begin with a valid
+// representation.
+template <reflexible T>
+auto
+from_json(std::string_view in, T& x) -> std::size_t {
+    auto r = detail::json_reader{in.data(), in.data() + in.size()};
+    return detail::read_json(r, x) ? std::size_t(r.position - in.data()) : 0;
+}
+
+} // namespace mirror
+
+#endif // H_6E38F27476E542AE9F815F5778FF97F0
@@ -0,0 +1,309 @@
+// Copyright Nezametdinov E. Ildus 2022.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef H_DA5665687958466DBAD52401A6708141
+#define H_DA5665687958466DBAD52401A6708141
+
+#include "mirror_core.hh"
+
+#include <cstddef>
+
+#include <algorithm>
+#include <optional>
+#include <span>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include <version>
+
+#if defined(__cpp_lib_execution)
+#include <execution>
+#endif
+
+namespace mirror {
+
+////////////////////////////////////////////////////////////////////////////////
+// Executors.
+////////////////////////////////////////////////////////////////////////////////
+
+// An executor which runs chunks of work on threads which it creates for each
+// operation. One of the chunks is run on the calling thread. If the number of
+// threads is zero, then the number of hardware threads is used.
+struct thread_executor {
+    std::size_t thread_count{};
+};
+
+namespace detail {
+
+// Minimum number of records in a chunk of work. Smaller spans are split into
+// fewer chunks, so that the cost of starting threads does not dominate.
+constexpr auto min_chunk_size = std::size_t{4096};
+
+// Returns the number of hardware threads, or one if it is not known.
+inline auto
+hardware_thread_count() noexcept -> std::size_t {
+    return std::max(std::size_t{std::thread::hardware_concurrency()},
+                    std::size_t{1});
+}
+
+// Returns the number of threads which the given executor uses.
+inline auto
+thread_count_of(const thread_executor& executor) noexcept -> std::size_t {
+    return (executor.thread_count != 0) ? executor.thread_count
+                                        : hardware_thread_count();
+}
+
+// Invokes the given function with indices of chunks in the range [0, n) on
+// threads which are created by the given executor. Threads are joined when
+// they are destroyed, even if the creation of some of them fails.
+template <typename F>
+void
+execute_chunks(const thread_executor&, std::size_t n, F& f) {
+    auto threads = std::vector<std::jthread>{};
+    threads.reserve(n - 1);
+
+    for(auto i = std::size_t{1}; i < n; ++i) {
+        threads.emplace_back([&f, i] { f(i); });
+    }
+
+    f(std::size_t{0});
+}
+
+#if defined(__cpp_lib_execution)
+
+// A concept that models standard execution policies.
+template <typename T>
+concept execution_policy =
+    std::is_execution_policy_v<std::remove_cvref_t<T>>;
+
+// Returns the number of chunks into which work is split for the given
+// execution policy.
+template <execution_policy Policy>
+auto
+thread_count_of(const Policy&) noexcept -> std::size_t {
+    return hardware_thread_count();
+}
+
+// Invokes the given function with indices of chunks in the range [0, n) using
+// the given execution policy.
+template <execution_policy Policy, typename F>
+void
+execute_chunks(Policy&& policy, std::size_t n, F& f) {
+    auto chunks = std::vector<std::size_t>(n);
+    for(auto i = std::size_t{0}; i != n; ++i) {
+        chunks[i] = i;
+    }
+
+    std::for_each(
+        std::forward<Policy>(policy), chunks.begin(), chunks.end(), f);
+}
+
+#endif
+
+// Splits the given number of records into chunks, and invokes the given
+// function with the index of each chunk and the range of indices of its
+// records, using the given executor. Returns the number of chunks.
+template <typename Executor, typename F>
+auto
+split_into_chunks(std::size_t n, Executor&& executor, F&& f) -> std::size_t {
+    auto chunk_count = std::min(thread_count_of(executor),
+                                (n + min_chunk_size - 1) / min_chunk_size);
+
+    if(chunk_count == 0) {
+        return 0;
+    }
+
+    auto run_chunk = [&](std::size_t i) {
+        f(i, n * i / chunk_count, n * (i + 1) / chunk_count);
+    };
+
+    if(chunk_count == 1) {
+        run_chunk(0);
+    } else {
+        execute_chunks(
+            std::forward<Executor>(executor), chunk_count, run_chunk);
+    }
+
+    return chunk_count;
+}
+
+// Reduces the given records. Each chunk of records is reduced on a separate
+// thread: the partial result is initialized from the first record of the chunk
+// with the given function, and is updated with each subsequent record with the
+// given function. Partial results are then combined in the order of chunks, so
+// the result does not depend on scheduling. Returns an empty optional if there
+// are no records.
+template <typename T, typename Executor, typename Init, typename Update,
+          typename Combine>
+auto
+reduce_records(std::span<T> records, Executor&& executor, Init init,
+               Update update, Combine combine)
+    -> std::optional<decltype(init(records[0]))> {
+    using result = decltype(init(records[0]));
+
+    auto partials = std::vector<std::optional<result>>(
+        std::min(thread_count_of(executor), records.size()));
+
+    auto chunk_count = split_into_chunks(
+        records.size(), std::forward<Executor>(executor),
+        [&](std::size_t i, std::size_t first, std::size_t last) {
+            auto r = init(records[first]);
+            for(auto j = first + 1; j < last; ++j) {
+                update(r, records[j]);
+            }
+
+            partials[i] = std::move(r);
+        });
+
+    if(chunk_count == 0) {
+        return std::nullopt;
+    }
+
+    for(auto i = std::size_t{1}; i != chunk_count; ++i) {
+        combine(*partials[0], *partials[i]);
+    }
+
+    return std::move(partials[0]);
+}
+
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////
+// Parallel member visitation.
+////////////////////////////////////////////////////////////////////////////////
+
+// Invokes the given function with each non-static data member of each of the
+// given records. The span is split into contiguous chunks, which are processed
+// concurrently using the given executor: either a thread_executor, or a
+// standard execution policy (if the standard library supports them). The
+// function must be safe to invoke concurrently, and, if the policy allows
+// vectorization, it must also satisfy the requirements of the policy.
+template <reflexible T, typename F, typename Executor = thread_executor>
+void
+parallel_for_each_member(std::span<T> records, F f,
+                         Executor&& executor = Executor{}) {
+    detail::split_into_chunks(
+        records.size(), std::forward<Executor>(executor),
+        [&](std::size_t, std::size_t first, std::size_t last) {
+            for(auto i = first; i != last; ++i) {
+                for_each_member(records[i], f);
+            }
+        });
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Parallel reductions.
+////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// A predicate which shows if all non-static data members of the given type are
+// arithmetic, excluding bool.
+template <typename T>
+constexpr auto has_arithmetic_members =
+    []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+        return ((std::is_arithmetic_v<member_type_t<T, Indices>> &&
+                 !std::same_as<std::remove_cv_t<member_type_t<T, Indices>>,
+                               bool>) &&
+                ...);
+    }(std::make_index_sequence<data_member_count<T>>{});
+
+// Type of the accumulator of sums of values of the given arithmetic type.
+template <typename T>
+using sum_type = std::conditional_t<
+    std::is_floating_point_v<T>, std::common_type_t<T, double>,
+    std::conditional_t<std::is_signed_v<T>, long long, unsigned long long>>;
+
+// Computes the type of per-member sums of objects of the given type.
+template <typename T, std::size_t... Indices>
+auto
+member_sums_of(std::index_sequence<Indices...>)
+    -> std::tuple<sum_type<std::remove_cv_t<member_type_t<T, Indices>>>...>;
+
+} // namespace detail
+
+// A concept that models types whose objects can be reduced member-wise: all of
+// their non-static data members are arithmetic (excluding bool).
+template <typename T>
+concept reducible = reflexible<T> && (data_member_count<T> != 0) &&
+                    detail::has_arithmetic_members<T>;
+
+// A tuple of per-member sums of objects of the given type. Integers are summed
+// as long long or unsigned long long, and floating-point numbers as at least
+// double, so that sums of many records do not overflow the types of members.
+template <reducible T>
+using member_sums = decltype(detail::member_sums_of<std::remove_cv_t<T>>(
+    std::make_index_sequence<data_member_count<T>>{}));
+
+// Computes per-member sums of the given records, using the given executor.
+// Partial sums of chunks are combined in a fixed order, so for a given number
+// of threads the result is deterministic.
+template <typename T, typename Executor = thread_executor>
+auto
+parallel_sum(std::span<T> records, Executor&& executor = Executor{})
+    -> member_sums<T> requires(reducible<T>) {
+    auto accumulate = [](member_sums<T>& r, const T& x) {
+        for_each_member_indexed(x, [&](auto i, auto& m) {
+            std::get<decltype(i)::value>(r) += m;
+        });
+    };
+
+    auto result = detail::reduce_records(
+        records, std::forward<Executor>(executor),
+        [&](const T& x) {
+            auto r = member_sums<T>{};
+            accumulate(r, x);
+            return r;
+        },
+        accumulate,
+        [](member_sums<T>& r, const member_sums<T>& partial) {
+            [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+                ((std::get<Indices>(r) += std::get<Indices>(partial)), ...);
+            }(std::make_index_sequence<std::tuple_size_v<member_sums<T>>>{});
+        });
+
+    return result ? *result : member_sums<T>{};
+}
+
+// Computes per-member minimums of the given records, using the given executor.
+// Returns an object whose members hold the minimums, or an empty optional if
+// there are no records.
+template <typename T, typename Executor = thread_executor>
+auto
+parallel_min(std::span<T> records, Executor&& executor = Executor{})
+    -> std::optional<std::remove_cv_t<T>> requires(reducible<T>) {
+    using R = std::remove_cv_t<T>;
+
+    auto update = [](R& r, const R& x) {
+        for_each_member(r, x, [](auto& a, auto& b) { a = std::min(a, b); });
+    };
+
+    return detail::reduce_records(
+        records, std::forward<Executor>(executor),
+        [](const R& x) { return x; }, update, update);
+}
+
+// Computes per-member maximums of the given records, using the given executor.
+// Returns an object whose members hold the maximums, or an empty optional if
+// there are no records.
+template <typename T, typename Executor = thread_executor>
+auto
+parallel_max(std::span<T> records, Executor&& executor = Executor{})
+    -> std::optional<std::remove_cv_t<T>> requires(reducible<T>) {
+    using R = std::remove_cv_t<T>;
+
+    auto update = [](R& r, const R& x) {
+        for_each_member(r, x, [](auto& a, auto& b) { a = std::max(a, b); });
+    };
+
+    return detail::reduce_records(
+        records, std::forward<Executor>(executor),
+        [](const R& x) { return x; }, update, update);
+}
+
+} // namespace mirror
+
+#endif // H_DA5665687958466DBAD52401A6708141
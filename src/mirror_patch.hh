@@ -0,0 +1,167 @@
+// Copyright Nezametdinov E. Ildus 2022.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef H_B0595FFE9AFA45C394C5F85241E670FA
+#define H_B0595FFE9AFA45C394C5F85241E670FA
+
+#include "mirror_compare.hh"
+#include "mirror_core.hh"
+#include "mirror_serialization.hh"
+
+#include <cstddef>
+#include <cstring>
+
+#include <memory>
+#include <span>
+
+namespace mirror {
+
+////////////////////////////////////////////////////////////////////////////////
+// Patch traits.
+////////////////////////////////////////////////////////////////////////////////
+
+// A concept that models types whose objects can be patched member-wise.
+template <typename T>
+concept patchable = reflexible<T> && serializable<T> &&
+                    (data_member_count<T> != 0);
+
+namespace detail {
+
+// Number of bytes in the mask of changed members in patches of objects of the
+// given type.
+template <typename T>
+constexpr auto patch_mask_size =
+    (data_member_count<T> + CHAR_BIT - 1) / CHAR_BIT;
+
+// Checks if the bit with the given index is set in the given mask.
+constexpr auto
+test_bit(const std::byte* mask, std::size_t i) noexcept -> bool {
+    return (mask[i / CHAR_BIT] & (std::byte{1} << (i % CHAR_BIT))) !=
+           std::byte{};
+}
+
+} // namespace detail
+
+// Maximum number of bytes in patches of objects of the given type.
+template <patchable T>
+constexpr auto max_patch_size =
+    detail::patch_mask_size<T> + serialized_size<T>;
+
+////////////////////////////////////////////////////////////////////////////////
+// Diff and patch.
+////////////////////////////////////////////////////////////////////////////////
+
+// Computes the difference between the given objects, and writes it to the
+// given buffer as a patch which transforms the first object into the second
+// one. The patch consists of a mask of changed non-static data members (the
+// bit with the index i, counting from the least significant bit of the first
+// byte, corresponds to the member with the index i), followed by serialized
+// values of changed members of the second object, in declaration order. Runs
+// of adjacent members with unique object representations are compared with a
+// single call to memcmp, and only the members of runs which differ are
+// compared individually. Returns the number of written bytes, or zero if the
+// buffer is too small.
+template <patchable T>
+auto
+diff(const T& x, const T& y, std::span<std::byte> out) noexcept -> std::size_t {
+    constexpr auto mask_size = detail::patch_mask_size<T>;
+
+    if(out.size() < mask_size) {
+        return 0;
+    }
+
+    std::memset(out.data(), 0, mask_size);
+
+    auto tx = reflect(x);
+    auto ty = reflect(y);
+
+    return [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+        constexpr auto& plan = detail::comparison_plan_of<T>;
+
+        auto size = mask_size;
+        auto is_run_equal = false;
+
+        auto is_changed = [&](auto i) {
+            constexpr auto I = decltype(i)::value;
+            auto& mx = std::get<I>(tx);
+            auto& my = std::get<I>(ty);
+
+            if constexpr(plan.run_sizes[I] != 0) {
+                is_run_equal = (std::memcmp(std::addressof(mx),
+                                            std::addressof(my),
+                                            plan.run_sizes[I]) == 0);
+            }
+
+            if constexpr((plan.run_sizes[I] != 0) || plan.is_covered[I]) {
+                return !is_run_equal &&
+                       (std::memcmp(std::addressof(mx), std::addressof(my),
+                                    sizeof(mx)) != 0);
+            } else {
+                return !detail::equal_objects(mx, my);
+            }
+        };
+
+        auto is_written = (
+            [&] {
+                if(!is_changed(detail::index<Indices>{})) {
+                    return true;
+                }
+
+                auto n = serialize(out.subspan(size), std::get<Indices>(ty));
+
+                out[Indices / CHAR_BIT] |= std::byte{1} << (Indices % CHAR_BIT);
+                size += n;
+
+                return n != 0;
+            }() &&
+            ...);
+
+        return is_written ? size : 0;
+    }(std::make_index_sequence<data_member_count<T>>{});
+}
+
+// Applies the given patch, which was produced by the diff function, to the
+// given object. Returns the number of read bytes, or zero if the patch is
+// malformed, in which case the object is left unchanged.
+template <patchable T>
+auto
+apply_patch(T& x, std::span<const std::byte> patch) noexcept -> std::size_t {
+    constexpr auto mask_size = detail::patch_mask_size<T>;
+
+    if(patch.size() < mask_size) {
+        return 0;
+    }
+
+    return [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+        // Compute the size of the patch from its mask.
+        auto size =
+            (mask_size + ... +
+             (detail::test_bit(patch.data(), Indices)
+                  ? serialized_size<member_type_t<T, Indices>>
+                  : 0));
+
+        if(patch.size() < size) {
+            return std::size_t{0};
+        }
+
+        auto tx = reflect(x);
+        auto offset = mask_size;
+
+        (
+            [&] {
+                if(detail::test_bit(patch.data(), Indices)) {
+                    offset += deserialize(
+                        patch.subspan(offset), std::get<Indices>(tx));
+                }
+            }(),
+            ...);
+
+        return size;
+    }(std::make_index_sequence<data_member_count<T>>{});
+}
+
+} // namespace mirror
+
+#endif // H_B0595FFE9AFA45C394C5F85241E670FA
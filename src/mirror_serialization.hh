@@ -0,0 +1,470 @@
+// Copyright Nezametdinov E. Ildus 2022.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef H_5F0C8E2B9A7D4C31B6E40D2F18A93C57
+#define H_5F0C8E2B9A7D4C31B6E40D2F18A93C57
+
+#include "mirror_core.hh"
+#include "mirror_hash.hh"
+#include "mirror_stats.hh"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include <array>
+#include <memory>
+#include <optional>
+#include <span>
+
+namespace mirror {
+
+////////////////////////////////////////////////////////////////////////////////
+// Serialization traits.
+////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// A predicate which shows if objects of the given type can be serialized.
+// Trivially copyable types which can not be reflected are serialized as is.
+// Reflexible types are serialized member-wise, which requires references to
+// their members, hence types with bit-fields can not be serialized.
+template <typename T>
+constexpr auto
+is_serializable() noexcept -> bool {
+    if constexpr(!std::is_trivially_copyable_v<T>) {
+        return false;
+    } else if constexpr(!reflexible<T>) {
+        return true;
+    } else if constexpr(has_bit_fields_of<T>) {
+        return false;
+    } else {
+        return []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+            return (is_serializable<member_type_t<T, Indices>>() && ...);
+        }(std::make_index_sequence<data_member_count<T>>{});
+    }
+}
+
+// Computes the number of bytes which objects of the given type occupy when
+// serialized. This is the size of the type without padding bytes.
+template <typename T>
+constexpr auto
+compute_serialized_size() noexcept -> std::size_t {
+    if constexpr(!reflexible<T>) {
+        return sizeof(T);
+    } else {
+        return []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+            return (std::size_t{0} + ... +
+                    compute_serialized_size<member_type_t<T, Indices>>());
+        }(std::make_index_sequence<data_member_count<T>>{});
+    }
+}
+
+} // namespace detail
+
+// A concept that models types which can be serialized.
+template <typename T>
+concept serializable = detail::is_serializable<T>();
+
+// Number of bytes which objects of the given type occupy when serialized.
+template <serializable T>
+constexpr auto serialized_size = detail::compute_serialized_size<T>();
+
+// A predicate which shows if objects of the given type can be serialized with
+// a single copy of their object representation, i.e. if the type does not
+// contain padding bytes.
+template <typename T>
+constexpr auto is_trivially_serializable = [] {
+    if constexpr(serializable<T>) {
+        return serialized_size<T> == sizeof(T);
+    } else {
+        return false;
+    }
+}();
+
+////////////////////////////////////////////////////////////////////////////////
+// Serialization plans.
+////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// A contiguous range of bytes which is copied as a whole between an object and
+// a buffer. Offsets are relative to the beginning of the object and of the
+// buffer respectively.
+struct segment {
+    std::size_t source, destination, size;
+};
+
+// A predicate which shows if objects of the given serializable type can be
+// copied in segments: either the type is trivially serializable, or its member
+// offsets are verified, and so are the offsets of its reflexible members.
+template <typename T>
+constexpr auto has_segments = [] {
+    if constexpr(is_trivially_serializable<T>) {
+        return true;
+    } else if constexpr(!has_sequential_layout<T>) {
+        return false;
+    } else {
+        return []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+            return (has_segments<member_type_t<T, Indices>> && ...);
+        }(std::make_index_sequence<data_member_count<T>>{});
+    }
+}();
+
+// Computes the maximum number of segments in objects of the given type.
+template <typename T>
+constexpr auto
+count_segments() noexcept -> std::size_t {
+    if constexpr(is_trivially_serializable<T>) {
+        return 1;
+    } else {
+        return []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+            return (std::size_t{0} + ... +
+                    count_segments<member_type_t<T, Indices>>());
+        }(std::make_index_sequence<data_member_count<T>>{});
+    }
+}
+
+// Appends segments of an object of the given type, which is located at the
+// given offset, to the given list. Adjacent segments are merged, so runs of
+// members without padding between them are copied at once.
+template <typename T>
+constexpr void
+append_segments(segment* list, std::size_t& n, std::size_t source,
+                std::size_t& destination) noexcept {
+    if constexpr(is_trivially_serializable<T>) {
+        if((n != 0) && (list[n - 1].source + list[n - 1].size == source) &&
+           (list[n - 1].destination + list[n - 1].size == destination)) {
+            list[n - 1].size += sizeof(T);
+        } else {
+            list[n++] = segment{source, destination, sizeof(T)};
+        }
+
+        destination += sizeof(T);
+    } else {
+        [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+            (append_segments<member_type_t<T, Indices>>(
+                 list, n, source + member_offsets<T>[Indices], destination),
+             ...);
+        }(std::make_index_sequence<data_member_count<T>>{});
+    }
+}
+
+// Computes the list of segments of objects of the given type. Returns the
+// list, which may contain unused elements, and the number of used elements.
+template <typename T>
+constexpr auto
+compute_segments() noexcept {
+    auto result = std::pair{
+        std::array<segment, count_segments<T>()>{}, std::size_t{0}};
+
+    auto destination = std::size_t{0};
+    append_segments<T>(result.first.data(), result.second, 0, destination);
+
+    return result;
+}
+
+// Segments of objects of the given type. Serialization copies each of these
+// segments with a single call to memcpy.
+//
+// clang-format off
+template <typename T>
+constexpr auto
+segments =
+    []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+        constexpr auto list = compute_segments<T>().first;
+        return std::array<segment, sizeof...(Indices)>{list[Indices]...};
+    }(std::make_index_sequence<compute_segments<T>().second>{});
+// clang-format on
+
+// Copies the given segments from the given object representation to the given
+// buffer. The segments are passed by value, so types whose objects consist of
+// the same segments share the implementation.
+template <auto Segments>
+void
+write_segments(std::byte* out, const std::byte* source) noexcept {
+    [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+        ((std::memcpy(out + Segments[Indices].destination,
+                      source + Segments[Indices].source,
+                      Segments[Indices].size)),
+         ...);
+    }(std::make_index_sequence<Segments.size()>{});
+}
+
+// Copies the given segments from the given buffer to the given object
+// representation.
+template <auto Segments>
+void
+read_segments(std::byte* destination, const std::byte* in) noexcept {
+    [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+        ((std::memcpy(destination + Segments[Indices].source,
+                      in + Segments[Indices].destination,
+                      Segments[Indices].size)),
+         ...);
+    }(std::make_index_sequence<Segments.size()>{});
+}
+
+// Writes the given object to the given buffer. Types whose member offsets are
+// not verified (e.g. types with over-aligned members) are written member by
+// member, and the rest are written in segments.
+template <typename T>
+void
+write_object(std::byte* out, const T& x) noexcept {
+    auto source = reinterpret_cast<const std::byte*>(std::addressof(x));
+
+    if constexpr(is_trivially_serializable<T>) {
+        std::memcpy(out, source, sizeof(T));
+    } else if constexpr(has_segments<T>) {
+        write_segments<segments<T>>(out, source);
+    } else {
+        for_each_member(x, [&out]<typename M>(const M& member) {
+            write_object(out, member);
+            out += serialized_size<M>;
+        });
+    }
+}
+
+// Reads the given object from the given buffer, which contains data written
+// by the write_object function.
+template <typename T>
+void
+read_object(const std::byte* in, T& x) noexcept {
+    auto destination = reinterpret_cast<std::byte*>(std::addressof(x));
+
+    if constexpr(is_trivially_serializable<T>) {
+        std::memcpy(destination, in, sizeof(T));
+    } else if constexpr(has_segments<T>) {
+        read_segments<segments<T>>(destination, in);
+    } else {
+        for_each_member(x, [&in]<typename M>(M& member) {
+            read_object(in, member);
+            in += serialized_size<M>;
+        });
+    }
+}
+
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////
+// Serialization.
+////////////////////////////////////////////////////////////////////////////////
+
+// Serializes the given object to the given buffer. Non-static data members are
+// written in declaration order, in native byte order, without padding bytes.
+// Returns the number of written bytes, or zero if the buffer is too small.
+template <serializable T>
+auto
+serialize(std::span<std::byte> out, const T& x) noexcept -> std::size_t {
+    if(out.size() < serialized_size<T>) {
+        return 0;
+    }
+
+    [[maybe_unused]] auto scope =
+        detail::stats_scope<T, detail::operation::serialize>{
+            serialized_size<T>, is_trivially_serializable<T>};
+
+    detail::write_object(out.data(), x);
+    return serialized_size<T>;
+}
+
+// Deserializes the given object from the given buffer, which contains data
+// written by the serialize function. Returns the number of read bytes, or zero
+// if the buffer is too small.
+template <serializable T>
+auto
+deserialize(std::span<const std::byte> in, T& x) noexcept -> std::size_t {
+    if(in.size() < serialized_size<T>) {
+        return 0;
+    }
+
+    [[maybe_unused]] auto scope =
+        detail::stats_scope<T, detail::operation::deserialize>{
+            serialized_size<T>, is_trivially_serializable<T>};
+
+    detail::read_object(in.data(), x);
+    return serialized_size<T>;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+// Serialized views.
+////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// Offsets of non-static data members of the given type in the buffers which
+// are written by the serialize function. Members are written without padding
+// bytes, hence each offset is the sum of serialized sizes of the preceding
+// members.
+//
+// clang-format off
+template <typename T>
+constexpr auto
+serialized_offsets =
+    []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+        constexpr auto sizes = std::array<std::size_t, sizeof...(Indices)>{
+            serialized_size<member_type_t<T, Indices>>...};
+
+        auto offsets = std::array<std::size_t, sizeof...(Indices)>{};
+        for(auto i = std::size_t{1}; i < offsets.size(); ++i) {
+            offsets[i] = offsets[i - 1] + sizes[i - 1];
+        }
+
+        return offsets;
+    }(std::make_index_sequence<data_member_count<T>>{});
+// clang-format on
+
+} // namespace detail
+
+// A view of an object of the given reflexible type in a buffer which was
+// written by the serialize function. Offsets of members in the buffer are
+// computed at compile time, so reading a member decodes only the bytes of this
+// member: nothing is decoded until a member is read. The view does not own the
+// buffer, which must outlive it.
+template <serializable T>
+class view {
+    static_assert(reflexible<T>, "Views require reflexible types.");
+
+public:
+    // Type of the non-static data member with the given index.
+    template <std::size_t I>
+    using member_type = std::remove_cv_t<member_type_t<T, I>>;
+
+    // Creates a view of the given buffer. Returns an empty optional if the
+    // buffer is too small.
+    static auto
+    of(std::span<const std::byte> in) noexcept -> std::optional<view> {
+        if(in.size() < serialized_size<T>) {
+            return std::nullopt;
+        }
+
+        return view{in.template first<serialized_size<T>>()};
+    }
+
+    // Reads the non-static data member with the given index from the buffer
+    // into the given object.
+    template <std::size_t I>
+    void
+    read(member_type<I>& x) const noexcept {
+        deserialize(bytes<I>(), x);
+    }
+
+    // Returns a copy of the non-static data member with the given index, which
+    // is read from the buffer. Array members are read with the read function.
+    template <std::size_t I>
+    auto
+    get() const noexcept
+        -> member_type<I> requires(!std::is_array_v<member_type<I>>) {
+        auto x = member_type<I>{};
+        read<I>(x);
+
+        return x;
+    }
+
+    // Returns a view of the non-static data member with the given index, which
+    // must be of reflexible type.
+    template <std::size_t I>
+    auto
+    member_view() const noexcept -> view<member_type<I>>
+        requires(reflexible<member_type<I>>) {
+        return view<member_type<I>>{bytes<I>()};
+    }
+
+    // Returns the bytes of the serialized object, e.g. to forward it without
+    // decoding.
+    auto
+    data() const noexcept -> std::span<const std::byte, serialized_size<T>> {
+        return data_;
+    }
+
+private:
+    template <serializable U>
+    friend class view;
+
+    explicit view(std::span<const std::byte, serialized_size<T>> in) noexcept
+        : data_{in} {
+    }
+
+    // Returns the bytes of the non-static data member with the given index.
+    template <std::size_t I>
+    auto
+    bytes() const noexcept {
+        return data_.template subspan<detail::serialized_offsets<T>[I],
+                                      serialized_size<member_type<I>>>();
+    }
+
+    std::span<const std::byte, serialized_size<T>> data_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Checked serialization.
+////////////////////////////////////////////////////////////////////////////////
+
+// A concept that models types whose objects can be serialized as copies of
+// their object representations, which are tagged with layout fingerprints.
+template <typename T>
+concept fingerprinted =
+    std::is_trivially_copyable_v<T> && layout_computable<T>;
+
+// Number of bytes which objects of the given type occupy when serialized with
+// the serialize_checked function.
+template <fingerprinted T>
+constexpr auto checked_serialized_size = sizeof(std::uint64_t) + sizeof(T);
+
+// Serializes the given object to the given buffer: writes the layout
+// fingerprint of its type, followed by the object representation of the
+// object. Returns the number of written bytes, or zero if the buffer is too
+// small.
+template <fingerprinted T>
+auto
+serialize_checked(std::span<std::byte> out, const T& x) noexcept
+    -> std::size_t {
+    if(out.size() < checked_serialized_size<T>) {
+        return 0;
+    }
+
+    [[maybe_unused]] auto scope =
+        detail::stats_scope<T, detail::operation::serialize>{
+            checked_serialized_size<T>, true};
+
+    auto fingerprint = std::uint64_t{layout_fingerprint<T>};
+
+    std::memcpy(out.data(), &fingerprint, sizeof(fingerprint));
+    std::memcpy(out.data() + sizeof(fingerprint), std::addressof(x), sizeof(T));
+
+    return checked_serialized_size<T>;
+}
+
+// Deserializes the given object from the given buffer, which contains data
+// written by the serialize_checked function. The layout is validated with a
+// single comparison of fingerprints, and then the object is copied with a
+// single call to memcpy. Returns the number of read bytes, or zero if the
+// buffer is too small, or if it was written for a type with a different
+// layout.
+template <fingerprinted T>
+auto
+deserialize_checked(std::span<const std::byte> in, T& x) noexcept
+    -> std::size_t {
+    if(in.size() < checked_serialized_size<T>) {
+        return 0;
+    }
+
+    auto fingerprint = std::uint64_t{};
+    std::memcpy(&fingerprint, in.data(), sizeof(fingerprint));
+
+    if(fingerprint != layout_fingerprint<T>) {
+        return 0;
+    }
+
+    [[maybe_unused]] auto scope =
+        detail::stats_scope<T, detail::operation::deserialize>{
+            checked_serialized_size<T>, true};
+
+    std::memcpy(std::addressof(x), in.data() + sizeof(fingerprint), sizeof(T));
+    return checked_serialized_size<T>;
+}
+
+} // namespace mirror
+
+#endif // H_5F0C8E2B9A7D4C31B6E40D2F18A93C57
@@ -0,0 +1,392 @@
+// Copyright Nezametdinov E. Ildus 2022.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef H_3382EEE8D0CC45FEB3BB71DA51E0A15E
+#define H_3382EEE8D0CC45FEB3BB71DA51E0A15E
+
+#include "mirror_core.hh"
+
+#include <cstddef>
+#include <cstring>
+
+#include <algorithm>
+#include <memory>
+#include <span>
+#include <vector>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#include <xmmintrin.h>
+#endif
+
+namespace mirror {
+
+////////////////////////////////////////////////////////////////////////////////
+// Struct-of-arrays storage.
+////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// Storage of elements of a struct-of-arrays container: a tuple of vectors, one
+// for each non-static data member of the given type, and types of tuples which
+// refer to members of elements.
+template <typename T,
+          typename Indices = std::make_index_sequence<data_member_count<T>>>
+struct soa_storage;
+
+template <typename T, std::size_t... Indices>
+struct soa_storage<T, std::index_sequence<Indices...>> {
+    static_assert(
+        (!std::same_as<member_type_t<T, Indices>, bool> && ...),
+        "Members of type bool are not supported: std::vector<bool> does not "
+        "store its elements contiguously.");
+
+    using type = std::tuple<std::vector<member_type_t<T, Indices>>...>;
+
+    using reference = std::tuple<member_type_t<T, Indices>&...>;
+    using const_reference = std::tuple<const member_type_t<T, Indices>&...>;
+};
+
+} // namespace detail
+
+// A sequence container which stores each non-static data member of its
+// elements in a separate contiguous column. Elements are accessed through
+// tuples of references to their members.
+template <reflexible T>
+class soa_vector {
+    static_assert(data_member_count<T> != 0,
+                  "Types without non-static data members are not supported.");
+
+public:
+    // Number of columns.
+    static constexpr auto column_count = data_member_count<T>;
+
+    // Type of elements of the column with the given index.
+    template <std::size_t I>
+    using column_type = member_type_t<T, I>;
+
+    // Types of tuples which refer to members of elements.
+    using reference = typename detail::soa_storage<T>::reference;
+    using const_reference = typename detail::soa_storage<T>::const_reference;
+
+    // Returns the number of elements.
+    auto
+    size() const noexcept -> std::size_t {
+        return std::get<0>(columns_).size();
+    }
+
+    // Checks if the container has no elements.
+    auto
+    empty() const noexcept -> bool {
+        return size() == 0;
+    }
+
+    // Reserves storage for the given number of elements in each column.
+    void
+    reserve(std::size_t n) {
+        std::apply([n](auto&... columns) { (columns.reserve(n), ...); },
+                   columns_);
+    }
+
+    // Removes all elements.
+    void
+    clear() noexcept {
+        std::apply([](auto&... columns) { (columns.clear(), ...); }, columns_);
+    }
+
+    // Appends a copy of the given element: each of its members is appended to
+    // the corresponding column. If an exception is thrown, then the container
+    // is left unchanged (provided that move constructors of members do not
+    // throw): storage is reserved in all columns, and members whose copy
+    // constructors may throw are copied, before any column grows.
+    void
+    push_back(const T& x) {
+        grow(size() + 1);
+
+        [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+            auto members = reflect(x);
+
+            if constexpr((std::is_nothrow_copy_constructible_v<
+                              column_type<Indices>> &&
+                          ...)) {
+                (std::get<Indices>(columns_).push_back(
+                     std::get<Indices>(members)),
+                 ...);
+            } else {
+                auto copies = std::tuple<column_type<Indices>...>{
+                    std::get<Indices>(members)...};
+                (std::get<Indices>(columns_).push_back(
+                     std::move(std::get<Indices>(copies))),
+                 ...);
+            }
+        }(std::make_index_sequence<column_count>{});
+    }
+
+    // Returns a tuple of references to members of the element with the given
+    // index.
+    auto
+    operator[](std::size_t i) noexcept -> reference {
+        return std::apply(
+            [i](auto&... columns) { return reference{columns[i]...}; },
+            columns_);
+    }
+
+    auto
+    operator[](std::size_t i) const noexcept -> const_reference {
+        return std::apply(
+            [i](auto&... columns) { return const_reference{columns[i]...}; },
+            columns_);
+    }
+
+    // Returns the column with the given index.
+    template <std::size_t I>
+    auto
+    column() noexcept -> std::span<column_type<I>> {
+        return std::get<I>(columns_);
+    }
+
+    template <std::size_t I>
+    auto
+    column() const noexcept -> std::span<const column_type<I>> {
+        return std::get<I>(columns_);
+    }
+
+private:
+    // Makes sure that each column has storage for the given number of
+    // elements. Capacities grow geometrically, so that appending elements
+    // takes amortized constant time.
+    void
+    grow(std::size_t n) {
+        auto reserve = [n](auto& column) {
+            if(column.capacity() < n) {
+                column.reserve(std::max(n, 2 * column.capacity()));
+            }
+        };
+
+        std::apply([&](auto&... columns) { (reserve(columns), ...); },
+                   columns_);
+    }
+
+    typename detail::soa_storage<T>::type columns_;
+};
+
+////////////////////////////////////////////////////////////////////////////////
+// Transposition kernels.
+////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// Types of tuples of column buffers of the given type: one span for each
+// non-static data member.
+template <typename T,
+          typename Indices = std::make_index_sequence<data_member_count<T>>>
+struct column_buffers;
+
+template <typename T, std::size_t... Indices>
+struct column_buffers<T, std::index_sequence<Indices...>> {
+    using type = std::tuple<std::span<member_type_t<T, Indices>>...>;
+    using const_type =
+        std::tuple<std::span<const member_type_t<T, Indices>>...>;
+};
+
+// Size of words which objects of the given type consist of, or zero if the
+// objects can not be transposed as matrices of words. This is possible if all
+// non-static data members are arithmetic types of the same size (4 or 8
+// bytes), there are no padding bytes, and each object occupies a whole number
+// of 16-byte vectors.
+//
+// clang-format off
+template <typename T>
+constexpr auto
+transpose_word_size = [] {
+    if constexpr(!layout_computable<T> || (data_member_count<T> == 0)) {
+        return std::size_t{0};
+    } else {
+        return []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+            constexpr auto size = sizeof(member_type_t<T, 0>);
+            constexpr auto is_uniform =
+                ((std::is_arithmetic_v<member_type_t<T, Indices>> &&
+                  (sizeof(member_type_t<T, Indices>) == size)) &&
+                 ...);
+
+            return ((is_uniform && (padding_bytes<T> == 0) &&
+                     ((size == 4) || (size == 8)) && (sizeof(T) % 16 == 0))
+                        ? size
+                        : std::size_t{0});
+        }(std::make_index_sequence<data_member_count<T>>{});
+    }
+}();
+// clang-format on
+
+// Transposes the matrix of words of the given size, which has the given
+// number of rows and columns, to the matrix with swapped dimensions. Rows of
+// the matrices are obtained with the given functions, which return pointers to
+// rows with the given indices. The kernels process blocks of 4 x 4 32-bit
+// words, or 2 x 2 64-bit words, and the remaining words are copied one by one.
+template <std::size_t Word_size, typename S, typename D>
+void
+transpose_words(std::size_t n_rows, std::size_t n_columns, S source,
+                D destination) noexcept {
+    // Copies words with indices in the given ranges one by one.
+    auto copy = [&](std::size_t i0, std::size_t i1, std::size_t k0) {
+        for(auto i = i0; i != i1; ++i) {
+            for(auto k = k0; k < n_columns; ++k) {
+                std::memcpy(destination(k) + i * Word_size,
+                            source(i) + k * Word_size, Word_size);
+            }
+        }
+    };
+
+#if defined(__SSE2__)
+    constexpr auto n = 16 / Word_size;
+
+    auto i = std::size_t{0};
+    for(; i + n <= n_rows; i += n) {
+        auto k = std::size_t{0};
+        for(; k + n <= n_columns; k += n) {
+            if constexpr(Word_size == 4) {
+                auto load = [&](std::size_t j) {
+                    return _mm_loadu_ps(
+                        reinterpret_cast<const float*>(source(i + j) + k * 4));
+                };
+
+                auto r0 = load(0), r1 = load(1), r2 = load(2), r3 = load(3);
+                _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+
+                // Destinations are obtained before storing, since stores might
+                // alias them.
+                float* d[] = {
+                    reinterpret_cast<float*>(destination(k + 0) + i * 4),
+                    reinterpret_cast<float*>(destination(k + 1) + i * 4),
+                    reinterpret_cast<float*>(destination(k + 2) + i * 4),
+                    reinterpret_cast<float*>(destination(k + 3) + i * 4)};
+
+                _mm_storeu_ps(d[0], r0);
+                _mm_storeu_ps(d[1], r1);
+                _mm_storeu_ps(d[2], r2);
+                _mm_storeu_ps(d[3], r3);
+            } else {
+                auto load = [&](std::size_t j) {
+                    return _mm_loadu_pd(
+                        reinterpret_cast<const double*>(source(i + j) + k * 8));
+                };
+
+                auto r0 = load(0), r1 = load(1);
+
+                double* d[] = {
+                    reinterpret_cast<double*>(destination(k + 0) + i * 8),
+                    reinterpret_cast<double*>(destination(k + 1) + i * 8)};
+
+                _mm_storeu_pd(d[0], _mm_unpacklo_pd(r0, r1));
+                _mm_storeu_pd(d[1], _mm_unpackhi_pd(r0, r1));
+            }
+        }
+
+        copy(i, i + n, k);
+    }
+
+    copy(i, n_rows, 0);
+#else
+    copy(0, n_rows, 0);
+#endif
+}
+
+// Checks if each of the given columns holds at least the given number of
+// elements.
+template <typename Columns>
+auto
+has_capacity(const Columns& columns, std::size_t n) noexcept -> bool {
+    return std::apply(
+        [n](auto&... columns) { return ((columns.size() >= n) && ...); },
+        columns);
+}
+
+} // namespace detail
+
+// A tuple of column buffers of the given type: spans of elements of types of
+// its non-static data members.
+template <reflexible T>
+using column_spans = typename detail::column_buffers<T>::type;
+
+// A tuple of read-only column buffers of the given type.
+template <reflexible T>
+using const_column_spans = typename detail::column_buffers<T>::const_type;
+
+// Copies each non-static data member of the given objects to the corresponding
+// column. Objects which consist of words of the same size (e.g. structures of
+// 4 floats, or of 8 32-bit integers) are transposed as matrices with SIMD
+// kernels, when these are available. Returns false if a column holds fewer
+// elements than there are objects, in which case nothing is copied.
+template <reflexible T>
+auto
+transpose_to_columns(std::span<const T> rows,
+                     const column_spans<T>& columns) noexcept -> bool {
+    if(!detail::has_capacity(columns, rows.size())) {
+        return false;
+    }
+
+    [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+        if constexpr(constexpr auto word_size = detail::transpose_word_size<T>;
+                     word_size != 0) {
+            auto source = reinterpret_cast<const std::byte*>(rows.data());
+            std::byte* destination[] = {reinterpret_cast<std::byte*>(
+                std::get<Indices>(columns).data())...};
+
+            detail::transpose_words<word_size>(
+                rows.size(), sizeof...(Indices),
+                [&](std::size_t i) { return source + i * sizeof(T); },
+                [&](std::size_t k) { return destination[k]; });
+        } else {
+            for(auto i = std::size_t{0}; i != rows.size(); ++i) {
+                auto members = reflect(rows[i]);
+                ((std::get<Indices>(columns)[i] = std::get<Indices>(members)),
+                 ...);
+            }
+        }
+    }(std::make_index_sequence<data_member_count<T>>{});
+
+    return true;
+}
+
+// Copies elements of the given columns to the corresponding non-static data
+// members of the given objects. This is the inverse of the
+// transpose_to_columns function. Returns false if a column holds fewer
+// elements than there are objects, in which case nothing is copied.
+template <reflexible T>
+auto
+transpose_from_columns(const const_column_spans<T>& columns,
+                       std::span<T> rows) noexcept -> bool {
+    if(!detail::has_capacity(columns, rows.size())) {
+        return false;
+    }
+
+    [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+        if constexpr(constexpr auto word_size = detail::transpose_word_size<T>;
+                     word_size != 0) {
+            // Columns form a matrix with one row for each member, which is
+            // transposed to the matrix of objects.
+            const std::byte* source[] = {reinterpret_cast<const std::byte*>(
+                std::get<Indices>(columns).data())...};
+            auto destination = reinterpret_cast<std::byte*>(rows.data());
+
+            detail::transpose_words<word_size>(
+                sizeof...(Indices), rows.size(),
+                [&](std::size_t k) { return source[k]; },
+                [&](std::size_t i) { return destination + i * sizeof(T); });
+        } else {
+            for(auto i = std::size_t{0}; i != rows.size(); ++i) {
+                auto members = reflect(rows[i]);
+                ((std::get<Indices>(members) = std::get<Indices>(columns)[i]),
+                 ...);
+            }
+        }
+    }(std::make_index_sequence<data_member_count<T>>{});
+
+    return true;
+}
+
+} // namespace mirror
+
+#endif // H_3382EEE8D0CC45FEB3BB71DA51E0A15E
@@ -0,0 +1,234 @@
+// Copyright Nezametdinov E. Ildus 2022.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef H_8E2E3E0890DC4213AF800C013564E5B4
+#define H_8E2E3E0890DC4213AF800C013564E5B4
+
+#include "mirror_core.hh"
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(MIRROR_ENABLE_RUNTIME_STATS)
+#include <array>
+#include <atomic>
+#include <chrono>
+#endif
+
+namespace mirror {
+
+////////////////////////////////////////////////////////////////////////////////
+// Runtime statistics.
+////////////////////////////////////////////////////////////////////////////////
+
+// Runtime statistics are only collected if the MIRROR_ENABLE_RUNTIME_STATS
+// macro is defined before the first inclusion of the library headers.
+// Otherwise operations are not instrumented, and the stats variable template is
+// not defined.
+
+namespace detail {
+
+// Operations which are instrumented.
+enum struct operation : std::size_t {
+    serialize,
+    deserialize,
+    hash,
+    compare
+};
+
+// Number of operations which are instrumented.
+constexpr auto operation_count = std::size_t{4};
+
+} // namespace detail
+
+#if defined(MIRROR_ENABLE_RUNTIME_STATS)
+
+// Statistics of the calls of an operation on objects of some type.
+struct operation_stats {
+    // Number of calls, and the number of bytes which they processed.
+    std::uint64_t calls, bytes;
+
+    // Numbers of calls which took the fast path (a single memcpy, memcmp or
+    // pass over the object representation), and which processed objects
+    // member-wise.
+    std::uint64_t fast_path_calls, member_wise_calls;
+
+    // Total duration of the calls in ticks of the time stamp counter (or of
+    // the steady clock, if the counter is not available).
+    std::uint64_t ticks;
+};
+
+// A snapshot of statistics of operations on objects of some type. Comparison
+// includes both equality and three-way comparison.
+struct stats_snapshot {
+    operation_stats serialize, deserialize, hash, compare;
+};
+
+namespace detail {
+
+// Number of sets of counters of each type. Each thread updates one of the
+// sets, so that threads rarely contend for the same cache line.
+constexpr auto stats_shard_count = std::size_t{16};
+
+// Counters of the calls of an operation.
+struct operation_counters {
+    std::atomic<std::uint64_t> calls, bytes, fast_path_calls, ticks;
+};
+
+// A set of counters of all operations, which occupies its own cache lines.
+struct alignas(64) stats_shard {
+    std::array<operation_counters, operation_count> operations;
+};
+
+// Returns the index of the set of counters which the calling thread updates.
+// Indices are assigned to threads in a round-robin fashion.
+inline auto
+stats_shard_index() noexcept -> std::size_t {
+    static constinit auto next = std::atomic<std::size_t>{};
+    thread_local auto index =
+        next.fetch_add(1, std::memory_order_relaxed) % stats_shard_count;
+
+    return index;
+}
+
+// Returns the current value of the time stamp counter.
+inline auto
+stats_ticks() noexcept -> std::uint64_t {
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#else
+    return static_cast<std::uint64_t>(
+        std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+}
+
+} // namespace detail
+
+// Runtime statistics of operations on objects of some type: serialization,
+// deserialization, hashing and comparison. Counters are updated with relaxed
+// atomic operations, hence snapshots taken while operations run concurrently
+// are not necessarily consistent.
+class type_stats {
+public:
+    // Returns the sums of the counters of all threads.
+    auto
+    snapshot() const noexcept -> stats_snapshot {
+        auto result = stats_snapshot{};
+        auto targets = std::array<operation_stats*, detail::operation_count>{
+            &result.serialize, &result.deserialize, &result.hash,
+            &result.compare};
+
+        for(auto& shard : shards_) {
+            for(auto i = std::size_t{0}; i != targets.size(); ++i) {
+                auto& counters = shard.operations[i];
+                auto& target = *targets[i];
+
+                target.calls += counters.calls.load(std::memory_order_relaxed);
+                target.bytes += counters.bytes.load(std::memory_order_relaxed);
+                target.fast_path_calls +=
+                    counters.fast_path_calls.load(std::memory_order_relaxed);
+                target.ticks += counters.ticks.load(std::memory_order_relaxed);
+            }
+        }
+
+        for(auto target : targets) {
+            target->member_wise_calls = target->calls - target->fast_path_calls;
+        }
+
+        return result;
+    }
+
+    // Resets all counters.
+    void
+    reset() noexcept {
+        for(auto& shard : shards_) {
+            for(auto& counters : shard.operations) {
+                counters.calls.store(0, std::memory_order_relaxed);
+                counters.bytes.store(0, std::memory_order_relaxed);
+                counters.fast_path_calls.store(0, std::memory_order_relaxed);
+                counters.ticks.store(0, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    // Records a call of the given operation in the counters of the calling
+    // thread.
+    void
+    record(detail::operation op, std::uint64_t bytes, bool is_fast_path,
+           std::uint64_t ticks) noexcept {
+        auto& counters = shards_[detail::stats_shard_index()]
+                             .operations[static_cast<std::size_t>(op)];
+
+        counters.calls.fetch_add(1, std::memory_order_relaxed);
+        counters.bytes.fetch_add(bytes, std::memory_order_relaxed);
+        counters.fast_path_calls.fetch_add(
+            is_fast_path ? 1 : 0, std::memory_order_relaxed);
+        counters.ticks.fetch_add(ticks, std::memory_order_relaxed);
+    }
+
+private:
+    std::array<detail::stats_shard, detail::stats_shard_count> shards_{};
+};
+
+// Runtime statistics of operations on objects of the given type. Operations
+// are recorded for the types of the objects which are passed to them (without
+// cv-qualifiers), not for the types of their members.
+template <typename T>
+inline auto stats = type_stats{};
+
+#endif // MIRROR_ENABLE_RUNTIME_STATS
+
+namespace detail {
+
+#if defined(MIRROR_ENABLE_RUNTIME_STATS)
+
+// A scope which records a call of the given operation on an object of the
+// given type in its statistics when it ends. It does nothing in constant
+// expressions.
+template <typename T, operation Operation>
+class stats_scope {
+public:
+    constexpr stats_scope(std::size_t bytes, bool is_fast_path) noexcept {
+        if(!std::is_constant_evaluated()) {
+            bytes_ = bytes;
+            is_fast_path_ = is_fast_path;
+            start_ = stats_ticks();
+        }
+    }
+
+    stats_scope(const stats_scope&) = delete;
+
+    constexpr ~stats_scope() {
+        if(!std::is_constant_evaluated()) {
+            stats<std::remove_cv_t<T>>.record(
+                Operation, bytes_, is_fast_path_, stats_ticks() - start_);
+        }
+    }
+
+    auto
+    operator=(const stats_scope&) -> stats_scope& = delete;
+
+private:
+    std::uint64_t bytes_{}, start_{};
+    bool is_fast_path_{};
+};
+
+#else
+
+// An empty scope, which is used if runtime statistics are not enabled, so that
+// instrumented operations do not change.
+template <typename T, operation Operation>
+struct stats_scope {
+    constexpr stats_scope(std::size_t, bool) noexcept {
+    }
+};
+
+#endif // MIRROR_ENABLE_RUNTIME_STATS
+
+} // namespace detail
+
+} // namespace mirror
+
+#endif // H_8E2E3E0890DC4213AF800C013564E5B4
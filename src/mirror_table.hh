@@ -0,0 +1,412 @@
+// Copyright Nezametdinov E. Ildus 2022.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at
+// https://www.boost.org/LICENSE_1_0.txt)
+//
+#ifndef H_A4C45E48139A4FCE925B2ED690CF657D
+#define H_A4C45E48139A4FCE925B2ED690CF657D
+
+#include "mirror_core.hh"
+#include "mirror_hash.hh"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace mirror {
+
+////////////////////////////////////////////////////////////////////////////////
+// Table schema.
+////////////////////////////////////////////////////////////////////////////////
+
+namespace detail {
+
+// Description of a non-static data member in the schema of a table. Besides
+// the placement of the member the description holds the layout fingerprint of
+// its type.
+struct table_member {
+    std::uint64_t offset, size, alignment;
+    type_kind kind;
+    std::uint64_t fingerprint;
+
+    friend constexpr auto
+    operator==(const table_member&, const table_member&) -> bool = default;
+};
+
+// Header of a table file. The header is followed by the descriptions of
+// non-static data members of records, and then by records, which start at the
+// given offset from the beginning of the file. The header also holds the layout
+// fingerprint of records.
+struct table_header {
+    std::uint64_t magic, version, fingerprint;
+    std::uint64_t record_size, record_alignment;
+    std::uint64_t member_count, record_count;
+    std::uint64_t data_offset;
+};
+
+// Signature of table files ("MIRRORTB" in little-endian byte order). Files
+// written on machines with different byte order are rejected.
+constexpr auto table_magic = std::uint64_t{0x4254524F5252494D};
+
+// Version of the format of table files.
+constexpr auto table_version = std::uint64_t{3};
+
+// A predicate which shows if the layout of the given type is fully described
+// by its layout fingerprint: the type is not reflexible, or it has computable
+// layout and all its members have fully described layouts, or it is an array
+// of elements with fully described layout.
+template <typename T>
+constexpr auto
+is_layout_described() noexcept -> bool {
+    if constexpr(std::is_array_v<T>) {
+        return is_layout_described<std::remove_extent_t<T>>();
+    } else if constexpr(!reflexible<T>) {
+        return true;
+    } else if constexpr(!layout_computable<T>) {
+        return false;
+    } else {
+        return []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+            return (is_layout_described<member_type_t<T, Indices>>() && ...);
+        }(std::make_index_sequence<data_member_count<T>>{});
+    }
+}
+
+// Computes the layout fingerprint of a non-static data member of the given
+// type. Fingerprints of members whose layout is not fully described are zero,
+// so that these members never match members in files.
+template <typename T>
+constexpr auto
+table_member_fingerprint() noexcept -> std::uint64_t {
+    if constexpr(is_layout_described<T>()) {
+        return hash_finalize(hash_layout<T>(hash_seed));
+    } else {
+        return 0;
+    }
+}
+
+// Schema of tables which hold records of the given type.
+//
+// clang-format off
+template <typename T>
+constexpr auto
+table_schema_of =
+    []<std::size_t... Indices>(std::index_sequence<Indices...>) {
+        return std::array<table_member, sizeof...(Indices)>{table_member{
+            layout<T>[Indices].offset, layout<T>[Indices].size,
+            layout<T>[Indices].alignment,
+            kind_of<member_type_t<T, Indices>>(),
+            table_member_fingerprint<member_type_t<T, Indices>>()}...};
+    }(std::make_index_sequence<data_member_count<T>>{});
+// clang-format on
+
+// Computes the offset of records in tables which hold records of the given
+// type.
+template <typename T>
+constexpr auto
+table_data_offset() noexcept -> std::size_t {
+    return align_up(sizeof(table_header) + sizeof(table_schema_of<T>),
+                    alignof(T));
+}
+
+} // namespace detail
+
+////////////////////////////////////////////////////////////////////////////////
+// Memory-mapped tables.
+////////////////////////////////////////////////////////////////////////////////
+
+// A read-only table of records of the given type, which is stored in a memory-
+// mapped file. The file starts with a header which holds the layout fingerprint
+// of records, and their schema: offsets, sizes, alignments, kinds of types and
+// layout fingerprints of non-static data members. If the fingerprint in the
+// file matches the layout fingerprint of the type, then records are accessed in
+// place, without copying. Otherwise records are remapped member-wise: each
+// member is read from the member with the same index in the file, if it has the
+// same layout fingerprint, and is value-initialized otherwise. Thus members of
+// reflexible types and arrays are never copied if their internal layout has
+// changed.
+template <layout_computable T>
+class mapped_table {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "Records must be trivially copyable.");
+
+public:
+    // Writes a table file with the given records. Returns true on success.
+    static auto
+    write(const char* path, std::span<const T> records) -> bool {
+        auto file = std::unique_ptr<std::FILE, decltype(&std::fclose)>{
+            std::fopen(path, "wb"), &std::fclose};
+
+        if(!file) {
+            return false;
+        }
+
+        auto header = detail::table_header{
+            .magic = detail::table_magic,
+            .version = detail::table_version,
+            .fingerprint = layout_fingerprint<T>,
+            .record_size = sizeof(T),
+            .record_alignment = alignof(T),
+            .member_count = schema.size(),
+            .record_count = records.size(),
+            .data_offset = data_offset};
+
+        auto prefix = std::vector<std::byte>(data_offset);
+        std::memcpy(prefix.data(), &header, sizeof(header));
+        std::memcpy(prefix.data() + sizeof(header), schema.data(),
+                    sizeof(schema));
+
+        if(std::fwrite(prefix.data(), 1, prefix.size(), file.get()) !=
+           prefix.size()) {
+            return false;
+        }
+
+        // Records are written in blocks. Padding bytes between members are
+        // zeroed, so that uninitialized memory is never written to the file.
+        constexpr auto block_size = std::size_t{256};
+        auto block = std::vector<std::byte>(block_size * sizeof(T));
+
+        for(auto i = std::size_t{0}; i < records.size(); i += block_size) {
+            auto n = std::min(block_size, records.size() - i);
+            auto size = n * sizeof(T);
+
+            if constexpr(std::has_unique_object_representations_v<T>) {
+                std::memcpy(block.data(), records.data() + i, size);
+            } else {
+                std::memset(block.data(), 0, size);
+                for(auto j = std::size_t{0}; j != n; ++j) {
+                    copy_members(block.data() + j * sizeof(T), records[i + j]);
+                }
+            }
+
+            if(std::fwrite(block.data(), 1, size, file.get()) != size) {
+                return false;
+            }
+        }
+
+        return std::fclose(file.release()) == 0;
+    }
+
+    // Opens the table file with the given path. Returns an empty optional if
+    // the file can not be mapped, or if it is not a valid table file.
+    static auto
+    open(const char* path) -> std::optional<mapped_table> {
+        auto fd = ::open(path, O_RDONLY);
+        if(fd == -1) {
+            return std::nullopt;
+        }
+
+        struct stat status = {};
+        auto result = std::optional<mapped_table>{};
+
+        if((::fstat(fd, &status) == 0) &&
+           (static_cast<std::size_t>(status.st_size) >=
+            sizeof(detail::table_header))) {
+            auto size = static_cast<std::size_t>(status.st_size);
+            auto address = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if(address != MAP_FAILED) {
+                if(auto table = mapped_table{address, size}; table.validate()) {
+                    result = std::move(table);
+                }
+            }
+        }
+
+        ::close(fd);
+        return result;
+    }
+
+    mapped_table(const mapped_table&) = delete;
+    mapped_table(mapped_table&& other) noexcept
+        : address_{std::exchange(other.address_, nullptr)}
+        , size_{std::exchange(other.size_, 0)}
+        , header_{other.header_}
+        , is_compatible_{other.is_compatible_} {
+    }
+
+    ~mapped_table() {
+        if(address_ != nullptr) {
+            ::munmap(address_, size_);
+        }
+    }
+
+    auto
+    operator=(const mapped_table&) -> mapped_table& = delete;
+
+    auto
+    operator=(mapped_table&& other) noexcept -> mapped_table& {
+        // The mapping of this table is released by the destructor of the
+        // other table.
+        std::swap(address_, other.address_);
+        std::swap(size_, other.size_);
+        header_ = other.header_;
+        is_compatible_ = other.is_compatible_;
+
+        return *this;
+    }
+
+    // Returns the number of records.
+    auto
+    size() const noexcept -> std::size_t {
+        return static_cast<std::size_t>(header_.record_count);
+    }
+
+    // Checks if the layout fingerprint in the file matches the fingerprint of
+    // the type, i.e. if records can be accessed in place.
+    auto
+    is_compatible() const noexcept -> bool {
+        return is_compatible_;
+    }
+
+    // Returns a view of records which refers to the mapped file, or an empty
+    // optional if the table is not compatible with the type. The view is valid
+    // as long as the table lives.
+    auto
+    records() const noexcept -> std::optional<std::span<const T>> {
+        if(!is_compatible_) {
+            return std::nullopt;
+        }
+
+        return std::span<const T>{reinterpret_cast<const T*>(data()), size()};
+    }
+
+    // Returns a copy of the record with the given index. Records are remapped
+    // member-wise if the table is not compatible with the type.
+    auto
+    read(std::size_t i) const noexcept -> T {
+        auto x = T{};
+        auto record = data() + i * header_.record_size;
+
+        if(is_compatible_) {
+            std::memcpy(std::addressof(x), record, sizeof(T));
+            return x;
+        }
+
+        auto destination = reinterpret_cast<std::byte*>(std::addressof(x));
+        auto members = file_schema();
+
+        for(auto j = std::size_t{0};
+            (j != schema.size()) && (j != members.size()); ++j) {
+            if((schema[j].fingerprint != 0) &&
+               (members[j].fingerprint == schema[j].fingerprint) &&
+               (members[j].size == schema[j].size)) {
+                std::memcpy(destination + schema[j].offset,
+                            record + members[j].offset, schema[j].size);
+            }
+        }
+
+        return x;
+    }
+
+    // Returns copies of all records.
+    auto
+    read_all() const -> std::vector<T> {
+        auto result = std::vector<T>(size());
+
+        if(is_compatible_) {
+            std::memcpy(result.data(), data(), size() * sizeof(T));
+        } else {
+            for(auto i = std::size_t{0}; i != result.size(); ++i) {
+                result[i] = read(i);
+            }
+        }
+
+        return result;
+    }
+
+private:
+    static constexpr auto& schema = detail::table_schema_of<T>;
+    static constexpr auto data_offset = detail::table_data_offset<T>();
+
+    mapped_table(void* address, std::size_t size) noexcept
+        : address_{address}, size_{size} {
+        std::memcpy(&header_, address, sizeof(header_));
+    }
+
+    // Copies non-static data members of the given record to the given buffer.
+    static void
+    copy_members(std::byte* destination, const T& x) noexcept {
+        [&]<std::size_t... Indices>(std::index_sequence<Indices...>) {
+            auto members = reflect(x);
+            (std::memcpy(destination + schema[Indices].offset,
+                         std::addressof(std::get<Indices>(members)),
+                         schema[Indices].size),
+             ...);
+        }(std::make_index_sequence<schema.size()>{});
+    }
+
+    // Validates the header and the schema in the file, and checks if the table
+    // is compatible with the type.
+    auto
+    validate() noexcept -> bool {
+        auto& h = header_;
+
+        if((h.magic != detail::table_magic) ||
+           (h.version != detail::table_version) || (h.record_size == 0)) {
+            return false;
+        }
+
+        // The schema and all records must fit in the file.
+        if(h.member_count > size_ / sizeof(detail::table_member)) {
+            return false;
+        }
+
+        auto schema_end =
+            sizeof(h) + h.member_count * sizeof(detail::table_member);
+
+        if((h.data_offset < schema_end) || (h.data_offset > size_) ||
+           (h.record_count > (size_ - h.data_offset) / h.record_size)) {
+            return false;
+        }
+
+        // Each member must fit in its record.
+        for(auto& member : file_schema()) {
+            if((member.offset > h.record_size) ||
+               (member.size > h.record_size - member.offset)) {
+                return false;
+            }
+        }
+
+        is_compatible_ = (h.fingerprint == layout_fingerprint<T>) &&
+                         (h.data_offset % alignof(T) == 0);
+
+        return true;
+    }
+
+    // Returns the pointer to the first record.
+    auto
+    data() const noexcept -> const std::byte* {
+        return static_cast<const std::byte*>(address_) + header_.data_offset;
+    }
+
+    // Returns the schema which is stored in the file. It immediately follows
+    // the header, and mappings start at page boundaries, so descriptions of
+    // members are suitably aligned.
+    auto
+    file_schema() const noexcept -> std::span<const detail::table_member> {
+        return {reinterpret_cast<const detail::table_member*>(
+                    static_cast<const std::byte*>(address_) + sizeof(header_)),
+                static_cast<std::size_t>(header_.member_count)};
+    }
+
+    void* address_{};
+    std::size_t size_{};
+    detail::table_header header_{};
+    bool is_compatible_{};
+};
+
+} // namespace mirror
+
+#endif // H_A4C45E48139A4FCE925B2ED690CF657D